@@ -106,6 +106,9 @@ RODUAFrame::addImportOptions() {
     oc.doRegister("weight-period", new Option_String("3600", "TIME"));
     oc.addDescription("weight-period", "Processing", "Aggregation period for the given weight files; triggers rebuilding of Contraction Hierarchy");
 
+    oc.doRegister("routing-cache", new Option_Bool(false));
+    oc.addDescription("routing-cache", "Processing", "Reuse the routes of repeated origin-destination pairs while the loaded weights do not change");
+
     oc.doRegister("astar.all-distances", new Option_FileName());
     oc.addDescription("astar.all-distances", "Processing", "Initialize lookup table for astar from the given file (generated by marouter --all-pairs-output)");
 
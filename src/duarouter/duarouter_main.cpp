@@ -48,6 +48,7 @@
 #include <utils/vehicle/AStarRouter.h>
 #include <utils/vehicle/CHRouter.h>
 #include <utils/vehicle/CHRouterWrapper.h>
+#include <utils/vehicle/CachingRouter.h>
 #include <utils/xml/XMLSubSys.h>
 #include <router/ROFrame.h>
 #include <router/ROLoader.h>
@@ -94,10 +95,16 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
     loader.openRoutes(net);
     // build the router
     SUMOAbstractRouter<ROEdge, ROVehicle>* router;
+    SUMOAbstractRouter<ROEdge, ROVehicle>::Operation op = &ROEdge::getTravelTimeStatic;
     const std::string measure = oc.getString("weight-attribute");
     const std::string routingAlgorithm = oc.getString("routing-algorithm");
     const SUMOTime begin = string2time(oc.getString("begin"));
     const SUMOTime end = string2time(oc.getString("end"));
+    // with time dependent weights the landmark distances are computed on the
+    // minimum travel times to remain lower bounds for every departure time
+    const bool timeDependent = oc.isSet("weight-files") || oc.isSet("lane-weight-files");
+    const SUMOAbstractRouter<ROEdge, ROVehicle>::Operation landmarkOperation = (timeDependent ?
+            &ROEdge::getMinimumTravelTimeStatic : &ROEdge::getTravelTimeStatic);
     if (measure == "traveltime") {
         if (routingAlgorithm == "dijkstra") {
             if (net.hasPermissions()) {
@@ -115,7 +122,7 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
                     lookup = new AStar::FLT(oc.getString("astar.all-distances"), (int)ROEdge::getAllEdges().size());
                 } else if (oc.isSet("astar.landmark-distances")) {
                     CHRouterWrapper<ROEdge, ROVehicle, prohibited_withPermissions<ROEdge, ROVehicle> > router(
-                        ROEdge::getAllEdges(), true, &ROEdge::getTravelTimeStatic,
+                        ROEdge::getAllEdges(), true, landmarkOperation,
                         begin, end, std::numeric_limits<int>::max(), 1);
                     ROVehicle defaultVehicle(SUMOVehicleParameter(), 0, net.getVehicleTypeSecure(DEFAULT_VTYPE_ID), &net);
                     lookup = new AStar::LMLT(oc.getString("astar.landmark-distances"), ROEdge::getAllEdges(), &router, &defaultVehicle,
@@ -129,7 +136,7 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
                     lookup = new AStar::FLT(oc.getString("astar.all-distances"), (int)ROEdge::getAllEdges().size());
                 } else if (oc.isSet("astar.landmark-distances")) {
                     CHRouterWrapper<ROEdge, ROVehicle, noProhibitions<ROEdge, ROVehicle> > router(
-                        ROEdge::getAllEdges(), true, &ROEdge::getTravelTimeStatic,
+                        ROEdge::getAllEdges(), true, landmarkOperation,
                         begin, end, std::numeric_limits<int>::max(), 1);
                     ROVehicle defaultVehicle(SUMOVehicleParameter(), 0, net.getVehicleTypeSecure(DEFAULT_VTYPE_ID), &net);
                     lookup = new AStar::LMLT(oc.getString("astar.landmark-distances"), ROEdge::getAllEdges(), &router, &defaultVehicle,
@@ -159,7 +166,6 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
             throw ProcessError("Unknown routing Algorithm '" + routingAlgorithm + "'!");
         }
     } else {
-        DijkstraRouter<ROEdge, ROVehicle, prohibited_withPermissions<ROEdge, ROVehicle> >::Operation op;
         if (measure == "CO") {
             op = &ROEdge::getEmissionEffort<PollutantsInterface::CO>;
         } else if (measure == "CO2") {
@@ -187,6 +193,12 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
                 ROEdge::getAllEdges(), oc.getBool("ignore-errors"), op, &ROEdge::getTravelTimeStatic);
         }
     }
+    if (oc.getBool("routing-cache")) {
+        // the loaded weights only change at the boundaries of the loaded intervals
+        const std::set<SUMOTime>& weightChanges = loader.getWeightBoundaries();
+        router = new CachingRouter<ROEdge, ROVehicle>(router, op, std::vector<SUMOTime>(weightChanges.begin(), weightChanges.end()),
+                nullptr, &ROEdge::getTravelTimeStatic);
+    }
     int carWalk = 0;
     for (const std::string& opt : oc.getStringVector("persontrip.transfer.car-walk")) {
         if (opt == "parkingAreas") {
@@ -42,7 +42,7 @@ std::vector<std::string>
 POI::getIDList() {
     std::vector<std::string> ids;
     ShapeContainer& shapeCont = MSNet::getInstance()->getShapeContainer();
-    shapeCont.getPOIs().insertIDs(ids);
+    shapeCont.insertPOIIDs(ids);
     return ids;
 }
 
@@ -130,7 +130,7 @@ POI::setParameter(const std::string& poiID, const std::string& param, const std:
 
 PointOfInterest*
 POI::getPoI(const std::string& id) {
-    PointOfInterest* sumoPoi = MSNet::getInstance()->getShapeContainer().getPOIs().get(id);
+    PointOfInterest* sumoPoi = MSNet::getInstance()->getShapeContainer().getPOI(id);
     if (sumoPoi == 0) {
         throw TraCIException("POI '" + id + "' is not known");
     }
@@ -141,12 +141,7 @@ POI::getPoI(const std::string& id) {
 NamedRTree*
 POI::getTree() {
     NamedRTree* t = new NamedRTree();
-    ShapeContainer& shapeCont = MSNet::getInstance()->getShapeContainer();
-    for (const auto& i : shapeCont.getPOIs()) {
-        const float cmin[2] = {(float)i.second->x(), (float)i.second->y()};
-        const float cmax[2] = {(float)i.second->x(), (float)i.second->y()};
-        t->Insert(cmin, cmax, i.second);
-    }
+    MSNet::getInstance()->getShapeContainer().fillPOITree(*t);
     return t;
 }
 
@@ -34,7 +34,7 @@ namespace libsumo {
 std::vector<std::string> Polygon::getIDList() {
     std::vector<std::string> ids;
     ShapeContainer& shapeCont = MSNet::getInstance()->getShapeContainer();
-    shapeCont.getPolygons().insertIDs(ids);
+    shapeCont.insertPolygonIDs(ids);
     return ids;
 }
 
@@ -114,7 +114,7 @@ Polygon::setFilled(std::string polygonID, bool filled) {
 
 SUMOPolygon*
 Polygon::getPolygon(const std::string& id) {
-    SUMOPolygon* p = MSNet::getInstance()->getShapeContainer().getPolygons().get(id);
+    SUMOPolygon* p = MSNet::getInstance()->getShapeContainer().getPolygon(id);
     if (p == 0) {
         throw TraCIException("Polygon '" + id + "' is not known");
     }
@@ -131,13 +131,7 @@ Polygon::setParameter(std::string& id, std::string& name, std::string& value) {
 NamedRTree*
 Polygon::getTree() {
     NamedRTree* t = new NamedRTree();
-    ShapeContainer& shapeCont = MSNet::getInstance()->getShapeContainer();
-    for (const auto& i : shapeCont.getPolygons()) {
-        Boundary b = i.second->getShape().getBoxBoundary();
-        const float cmin[2] = {(float) b.xmin(), (float) b.ymin()};
-        const float cmax[2] = {(float) b.xmax(), (float) b.ymax()};
-        t->Insert(cmin, cmax, i.second);
-    }
+    MSNet::getInstance()->getShapeContainer().fillPolygonTree(*t);
     return t;
 }
 
@@ -29,9 +29,11 @@
 #include <utils/geom/GeoConvHelper.h>
 #include <utils/options/OptionsIO.h>
 #include <utils/vehicle/IntermodalRouter.h>
+#include <utils/vehicle/ManyToManyRouter.h>
 #include <utils/vehicle/PedestrianRouter.h>
 #include <utils/xml/XMLSubSys.h>
 #include <microsim/MSNet.h>
+#include <microsim/MSProfiler.h>
 #include <microsim/MSEdgeControl.h>
 #include <microsim/MSInsertionControl.h>
 #include <microsim/MSEdge.h>
@@ -209,6 +211,52 @@ Simulation::findRoute(const std::string& from, const std::string& to, const std:
 }
 
 
+std::vector<double>
+Simulation::findTravelTimeMatrix(const std::vector<std::string>& from, const std::vector<std::string>& to, const std::string& typeID, const SUMOTime depart, const int routingMode) {
+    std::vector<const MSEdge*> origins;
+    for (const std::string& id : from) {
+        const MSEdge* const edge = MSEdge::dictionary(id);
+        if (edge == 0) {
+            throw TraCIException("Unknown from edge '" + id + "'.");
+        }
+        origins.push_back(edge);
+    }
+    std::vector<const MSEdge*> destinations;
+    for (const std::string& id : to) {
+        const MSEdge* const edge = MSEdge::dictionary(id);
+        if (edge == 0) {
+            throw TraCIException("Unknown to edge '" + id + "'.");
+        }
+        destinations.push_back(edge);
+    }
+    std::vector<double> result;
+    if (origins.empty() || destinations.empty()) {
+        return result;
+    }
+    SUMOVehicle* vehicle = 0;
+    if (typeID != "") {
+        SUMOVehicleParameter* pars = new SUMOVehicleParameter();
+        MSVehicleType* type = MSNet::getInstance()->getVehicleControl().getVType(typeID);
+        if (type == 0) {
+            throw TraCIException("The vehicle type '" + typeID + "' is not known.");
+        }
+        try {
+            const MSRoute* const routeDummy = new MSRoute("", ConstMSEdgeVector({ origins.front() }), false, 0, std::vector<SUMOVehicleParameter::Stop>());
+            vehicle = MSNet::getInstance()->getVehicleControl().buildVehicle(pars, routeDummy, type, false);
+        } catch (ProcessError& e) {
+            throw TraCIException("Invalid departure edge for vehicle type '" + typeID + "' (" + e.what() + ")");
+        }
+    }
+    const SUMOTime dep = depart < 0 ? MSNet::getInstance()->getCurrentTimeStep() : depart;
+    ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >& router = routingMode == ROUTING_MODE_AGGREGATED ? MSDevice_Routing::getMatrixRouter(vehicle) : MSNet::getInstance()->getMatrixRouterTT();
+    router.compute(origins, destinations, vehicle, dep, result);
+    if (vehicle != 0) {
+        MSNet::getInstance()->getVehicleControl().deleteVehicle(vehicle, true);
+    }
+    return result;
+}
+
+
 std::vector<TraCIStage>
 Simulation::findIntermodalRoute(const std::string& from, const std::string& to,
                                 const std::string& modes, SUMOTime depart, const int routingMode, double speed, double walkFactor,
@@ -356,6 +404,15 @@ Simulation::getParameter(const std::string& objectID, const std::string& key) {
         } else {
             throw TraCIException("Invalid parkingArea parameter '" + attrName + "'");
         }
+    } else if (StringUtils::startsWith(key, "profiling.")) {
+        // phase timing starts with the first query unless profiling-output is active
+        const std::string attrName = key.substr(10);
+        double value;
+        if (!MSProfiler::getValue(attrName, value)) {
+            throw TraCIException("Invalid profiling parameter '" + attrName + "'");
+        }
+        MSProfiler::enable();
+        return toString(value);
     } else {
         throw TraCIException("Parameter '" + key + "' is not supported.");
     }
@@ -73,6 +73,12 @@ public:
 
     static TraCIStage findRoute(const std::string& from, const std::string& to, const std::string& typeID, const SUMOTime depart, const int routingMode);
 
+    /** @brief computes the travel times between all pairs of the given edges (use "<taz>-source" and "<taz>-sink" for TAZ)
+     * @return the travel times in row major order (origins x destinations), -1 for unreachable pairs
+     */
+    static std::vector<double> findTravelTimeMatrix(const std::vector<std::string>& from, const std::vector<std::string>& to,
+            const std::string& typeID = "", const SUMOTime depart = -1, const int routingMode = 0);
+
     /* @note: default arrivalPos is not -1 because this would lead to very short walks when moving against the edge direction, 
      * instead the middle of the edge is used. DepartPos is treated differently so that 1-edge walks do not have length 0.
      */
@@ -45,6 +45,7 @@ def simulationStep(step=0):
 %include "std_vector.i"
 %include "std_string.i"
 %template(StringVector) std::vector<std::string>;
+%template(DoubleVector) std::vector<double>;
 %template(TraCIStageVector) std::vector<libsumo::TraCIStage>;
 
 // exception handling
@@ -322,18 +322,12 @@ ROMAAssignments::sue(const int maxOuterIteration, const int maxInnerIteration, c
     }
     for (int outer = 0; outer < maxOuterIteration; outer++) {
         for (int inner = 0; inner < maxInnerIteration; inner++) {
+            // update path costs, route utilities and probabilities
+            computePathProbabilities(myMatrix.getCells().begin(), myMatrix.getCells().end(), 0);
             for (std::vector<ODCell*>::const_iterator i = myMatrix.getCells().begin(); i != myMatrix.getCells().end(); ++i) {
                 ODCell* const c = *i;
                 const SUMOTime begin = myAdditiveTraffic ? myBegin : c->begin;
                 const SUMOTime end = myAdditiveTraffic ? myEnd : c->end;
-                // update path cost
-                for (std::vector<RORoute*>::const_iterator j = c->pathsVector.begin(); j != c->pathsVector.end(); ++j) {
-                    RORoute* r = *j;
-                    r->setCosts(myRouter.recomputeCosts(r->getEdgeVector(), myDefaultVehicle, 0));
-//                    std::cout << std::setprecision(20) << r->getID() << ":" << r->getCosts() << std::endl;
-                }
-                // calculate route utilities and probabilities
-                RouteCostCalculator<RORoute, ROEdge, ROVehicle>::getCalculator().calculateProbabilities(c->pathsVector, myDefaultVehicle, 0);
                 // calculate route flows
                 for (std::vector<RORoute*>::const_iterator j = c->pathsVector.begin(); j != c->pathsVector.end(); ++j) {
                     RORoute* r = *j;
@@ -385,27 +379,14 @@ ROMAAssignments::sue(const int maxOuterIteration, const int maxInnerIteration, c
         }
         // check for a new route, if none available, break
         // several modifications about when a route is new and when to break are in the original script
-        bool newRoute = false;
-        for (std::vector<ODCell*>::const_iterator i = myMatrix.getCells().begin(); i != myMatrix.getCells().end(); ++i) {
-            ODCell* c = *i;
-            ConstROEdgeVector edges;
-            myRouter.compute(myNet.getEdge(c->origin + "-source"), myNet.getEdge(c->destination + "-sink"), myDefaultVehicle, 0, edges);
-            newRoute |= addRoute(edges, c->pathsVector, c->origin + c->destination + toString(c->pathsVector.size()), 0);
-        }
-        if (!newRoute) {
+        if (!addShortestPaths(myMatrix.getCells().begin(), myMatrix.getCells().end(), 0)) {
             break;
         }
     }
     // final round of assignment
+    computePathProbabilities(myMatrix.getCells().begin(), myMatrix.getCells().end(), 0);
     for (std::vector<ODCell*>::const_iterator i = myMatrix.getCells().begin(); i != myMatrix.getCells().end(); ++i) {
         ODCell* c = *i;
-        // update path cost
-        for (std::vector<RORoute*>::const_iterator j = c->pathsVector.begin(); j != c->pathsVector.end(); ++j) {
-            RORoute* r = *j;
-            r->setCosts(myRouter.recomputeCosts(r->getEdgeVector(), myDefaultVehicle, 0));
-        }
-        // calculate route utilities and probabilities
-        RouteCostCalculator<RORoute, ROEdge, ROVehicle>::getCalculator().calculateProbabilities(c->pathsVector, myDefaultVehicle, 0);
         // calculate route flows
         for (std::vector<RORoute*>::const_iterator j = c->pathsVector.begin(); j != c->pathsVector.end(); ++j) {
             RORoute* r = *j;
@@ -415,6 +396,171 @@ ROMAAssignments::sue(const int maxOuterIteration, const int maxInnerIteration, c
 }
 
 
+void
+ROMAAssignments::ue(const int maxIterations, const double tolerance, const bool verbose) {
+    const std::vector<ROEdge*>& allEdges = ROEdge::getAllEdges();
+    std::vector<double> flows(allEdges.size());
+    std::vector<double> targetFlows(allEdges.size());
+    std::vector<ODCell*>::const_iterator first = myMatrix.getCells().begin();
+    while (first != myMatrix.getCells().end()) {
+        // the cells are sorted by begin time, the equilibrium is computed for each interval (or all at once for additive traffic)
+        std::vector<ODCell*>::const_iterator last = first;
+        SUMOTime end = myEnd;
+        if (myAdditiveTraffic) {
+            last = myMatrix.getCells().end();
+        } else {
+            end = (*first)->end;
+            while (last != myMatrix.getCells().end() && (*last)->begin == (*first)->begin) {
+                end = MAX2(end, (*last)->end);
+                ++last;
+            }
+        }
+        const SUMOTime begin = myAdditiveTraffic ? myBegin : (*first)->begin;
+        const double intervalLengthInHours = STEPS2TIME(end - begin) / 3600.;
+        if (verbose) {
+            WRITE_MESSAGE(" starting interval " + time2string(begin));
+        }
+        std::fill(flows.begin(), flows.end(), 0.);
+        for (int t = 0; t < maxIterations; t++) {
+            // all or nothing assignment on the current link costs, the shortest paths are the last ones of each cell
+            addShortestPaths(first, last, begin);
+            std::fill(targetFlows.begin(), targetFlows.end(), 0.);
+            for (std::vector<ODCell*>::const_iterator i = first; i != last; ++i) {
+                const ConstROEdgeVector& edges = (*i)->pathsVector.back()->getEdgeVector();
+                for (ConstROEdgeVector::const_iterator e = edges.begin(); e != edges.end(); ++e) {
+                    targetFlows[(*e)->getNumericalID()] += (*i)->vehicleNumber;
+                }
+            }
+            double lambda = 1.;
+            if (t > 0) {
+                double currentCosts = 0.;
+                double targetCosts = 0.;
+                for (int j = 0; j < (int)allEdges.size(); j++) {
+                    const double travelTime = capacityConstraintFunction(allEdges[j], flows[j] / intervalLengthInHours);
+                    currentCosts += travelTime * flows[j];
+                    targetCosts += travelTime * targetFlows[j];
+                }
+                const double relativeGap = currentCosts > 0. ? (currentCosts - targetCosts) / currentCosts : 0.;
+                if (verbose) {
+                    WRITE_MESSAGE("  iteration " + toString(t) + " relative gap " + toString(relativeGap));
+                }
+                if (relativeGap < tolerance) {
+                    // remove new paths from the last all or nothing assignment which did not get any flow
+                    for (std::vector<ODCell*>::const_iterator i = first; i != last; ++i) {
+                        if ((*i)->pathsVector.back()->getProbability() == 0.) {
+                            delete (*i)->pathsVector.back();
+                            (*i)->pathsVector.pop_back();
+                        }
+                    }
+                    break;
+                }
+                // line search, the derivative of the objective is monotonous in lambda
+                if (getObjectiveDerivative(flows, targetFlows, 1., intervalLengthInHours) > 0.) {
+                    double low = 0.;
+                    double high = 1.;
+                    for (int step = 0; step < 20; step++) {
+                        const double mid = (low + high) / 2.;
+                        if (getObjectiveDerivative(flows, targetFlows, mid, intervalLengthInHours) > 0.) {
+                            high = mid;
+                        } else {
+                            low = mid;
+                        }
+                    }
+                    lambda = (low + high) / 2.;
+                }
+            }
+            // shift the path flows and update the link costs
+            for (std::vector<ODCell*>::const_iterator i = first; i != last; ++i) {
+                for (std::vector<RORoute*>::const_iterator j = (*i)->pathsVector.begin(); j != (*i)->pathsVector.end(); ++j) {
+                    (*j)->setProbability((*j)->getProbability() * (1. - lambda));
+                }
+                (*i)->pathsVector.back()->addProbability(lambda * (*i)->vehicleNumber);
+            }
+            for (int j = 0; j < (int)allEdges.size(); j++) {
+                ROMAEdge* edge = static_cast<ROMAEdge*>(allEdges[j]);
+                flows[j] += lambda * (targetFlows[j] - flows[j]);
+                edge->setFlow(STEPS2TIME(begin), STEPS2TIME(end), flows[j]);
+                edge->addTravelTime(capacityConstraintFunction(edge, flows[j] / intervalLengthInHours), STEPS2TIME(begin), STEPS2TIME(end));
+            }
+        }
+        first = last;
+    }
+}
+
+
+double
+ROMAAssignments::getObjectiveDerivative(const std::vector<double>& flows, const std::vector<double>& targetFlows,
+                                        const double lambda, const double intervalLengthInHours) const {
+    const std::vector<ROEdge*>& allEdges = ROEdge::getAllEdges();
+    double result = 0.;
+    for (int j = 0; j < (int)allEdges.size(); j++) {
+        const double delta = targetFlows[j] - flows[j];
+        if (delta != 0.) {
+            result += capacityConstraintFunction(allEdges[j], (flows[j] + lambda * delta) / intervalLengthInHours) * delta;
+        }
+    }
+    return result;
+}
+
+
+bool
+ROMAAssignments::addShortestPaths(std::vector<ODCell*>::const_iterator first, std::vector<ODCell*>::const_iterator last, const SUMOTime time) {
+    bool newRoute = false;
+#ifdef HAVE_FOX
+    if (myNet.getThreadPool().size() > 0) {
+        // each task only modifies the paths of its own cell, new paths are detected afterwards in cell order
+        std::vector<int> numPaths;
+        for (std::vector<ODCell*>::const_iterator i = first; i != last; ++i) {
+            numPaths.push_back((int)(*i)->pathsVector.size());
+            myNet.getThreadPool().add(new RoutingTask(*this, *i, time, 0.));
+        }
+        myNet.getThreadPool().waitAll();
+        std::vector<int>::const_iterator n = numPaths.begin();
+        for (std::vector<ODCell*>::const_iterator i = first; i != last; ++i, ++n) {
+            newRoute |= (int)(*i)->pathsVector.size() > *n;
+        }
+        return newRoute;
+    }
+#endif
+    for (std::vector<ODCell*>::const_iterator i = first; i != last; ++i) {
+        ODCell* const c = *i;
+        ConstROEdgeVector edges;
+        myRouter.compute(myNet.getEdge(c->origin + "-source"), myNet.getEdge(c->destination + "-sink"), myDefaultVehicle, time, edges);
+        newRoute |= addRoute(edges, c->pathsVector, c->origin + c->destination + toString(c->pathsVector.size()), 0);
+    }
+    return newRoute;
+}
+
+
+void
+ROMAAssignments::computePathProbabilities(std::vector<ODCell*>::const_iterator first, std::vector<ODCell*>::const_iterator last, const SUMOTime time) {
+#ifdef HAVE_FOX
+    if (myNet.getThreadPool().size() > 0) {
+        // build the calculator before it is used concurrently
+        RouteCostCalculator<RORoute, ROEdge, ROVehicle>::getCalculator();
+        for (std::vector<ODCell*>::const_iterator i = first; i != last; ++i) {
+            myNet.getThreadPool().add(new PathCostTask(*this, *i, time));
+        }
+        myNet.getThreadPool().waitAll();
+        return;
+    }
+#endif
+    for (std::vector<ODCell*>::const_iterator i = first; i != last; ++i) {
+        computePathProbabilities(*i, myRouter, time);
+    }
+}
+
+
+void
+ROMAAssignments::computePathProbabilities(ODCell* const cell, SUMOAbstractRouter<ROEdge, ROVehicle>& router, const SUMOTime time) {
+    for (std::vector<RORoute*>::const_iterator j = cell->pathsVector.begin(); j != cell->pathsVector.end(); ++j) {
+        RORoute* r = *j;
+        r->setCosts(router.recomputeCosts(r->getEdgeVector(), myDefaultVehicle, time));
+    }
+    RouteCostCalculator<RORoute, ROEdge, ROVehicle>::getCalculator().calculateProbabilities(cell->pathsVector, myDefaultVehicle, time);
+}
+
+
 double
 ROMAAssignments::getPenalizedEffort(const ROEdge* const e, const ROVehicle* const v, double t) {
     const std::map<const ROEdge* const, double>::const_iterator i = myPenalties.find(e);
@@ -445,4 +591,13 @@ ROMAAssignments::RoutingTask::run(FXWorkerThread* context) {
     static_cast<RONet::WorkerThread*>(context)->getVehicleRouter().compute(myAssign.myNet.getEdge(myCell->origin + "-source"), myAssign.myNet.getEdge(myCell->destination + "-sink"), myAssign.myDefaultVehicle, myBegin, edges);
     myAssign.addRoute(edges, myCell->pathsVector, myCell->origin + myCell->destination + toString(myCell->pathsVector.size()), myLinkFlow);
 }
+
+
+// ---------------------------------------------------------------------------
+// ROMAAssignments::PathCostTask-methods
+// ---------------------------------------------------------------------------
+void
+ROMAAssignments::PathCostTask::run(FXWorkerThread* context) {
+    myAssign.computePathProbabilities(myCell, static_cast<RONet::WorkerThread*>(context)->getVehicleRouter(), myTime);
+}
 #endif
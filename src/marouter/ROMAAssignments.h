@@ -73,8 +73,15 @@ public:
     // @brief incremental method
     void incremental(const int numIter, const bool verbose);
 
-    // @brief UE method
-    void ue();
+    /** @brief UE method (path based Frank-Wolfe)
+     *
+     * Each iteration assigns all cells of an interval to their shortest path
+     *  under the current link costs (all or nothing), determines the step size
+     *  towards this assignment by a line search on the Beckmann objective and
+     *  shifts the path flows accordingly. It stops when the relative gap falls
+     *  below the tolerance.
+     */
+    void ue(const int maxIterations, const double tolerance, const bool verbose);
 
     // @brief SUE method
     void sue(const int maxOuterIteration, const int maxInnerIteration, const int kPaths, const double penalty, const double tolerance, const std::string routeChoiceMethod);
@@ -125,6 +132,23 @@ private:
     /// @brief get the k shortest paths
     void getKPaths(const int kPaths, const double penalty);
 
+    /** @brief add the current shortest path of each cell to its paths (as the last one)
+     *
+     * The searches run in parallel if threads are available.
+     * @return whether a path was new for at least one cell
+     */
+    bool addShortestPaths(std::vector<ODCell*>::const_iterator first, std::vector<ODCell*>::const_iterator last, const SUMOTime time);
+
+    /// @brief update the path costs and probabilities of the cells (in parallel if threads are available)
+    void computePathProbabilities(std::vector<ODCell*>::const_iterator first, std::vector<ODCell*>::const_iterator last, const SUMOTime time);
+
+    /// @brief update the path costs and probabilities of a single cell using the given router
+    void computePathProbabilities(ODCell* const cell, SUMOAbstractRouter<ROEdge, ROVehicle>& router, const SUMOTime time);
+
+    /// @brief the derivative of the Beckmann objective when moving the given fraction from the flows towards the target flows
+    double getObjectiveDerivative(const std::vector<double>& flows, const std::vector<double>& targetFlows,
+                                  const double lambda, const double intervalLengthInHours) const;
+
 private:
     const SUMOTime myBegin;
     const SUMOTime myEnd;
@@ -152,6 +176,20 @@ private:
         /// @brief Invalidated assignment operator.
         RoutingTask& operator=(const RoutingTask&);
     };
+
+    class PathCostTask : public FXWorkerThread::Task {
+    public:
+        PathCostTask(ROMAAssignments& assign, ODCell* c, const SUMOTime time)
+            : myAssign(assign), myCell(c), myTime(time) {}
+        void run(FXWorkerThread* context);
+    private:
+        ROMAAssignments& myAssign;
+        ODCell* const myCell;
+        const SUMOTime myTime;
+    private:
+        /// @brief Invalidated assignment operator.
+        PathCostTask& operator=(const PathCostTask&);
+    };
 #endif
 
 
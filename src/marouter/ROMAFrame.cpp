@@ -85,6 +85,9 @@ ROMAFrame::addImportOptions() {
     oc.doRegister("all-pairs-output", new Option_FileName());
     oc.addDescription("all-pairs-output", "Output", "Writes complete distance matrix into FILE");
 
+    oc.doRegister("od-matrix-output", new Option_FileName());
+    oc.addDescription("od-matrix-output", "Output", "Writes the TAZ to TAZ travel times after the assignment into FILE");
+
     oc.doRegister("net-file", 'n', new Option_FileName());
     oc.addSynonyme("net-file", "net");
     oc.addDescription("net-file", "Input", "Use FILE as SUMO-network to route on");
@@ -221,7 +224,7 @@ ROMAFrame::addAssignmentOptions() {
     oc.addDescription("assignment-method", "Processing", "Choose a assignment method: incremental, UE or SUE");
 
     oc.doRegister("tolerance", new Option_Float(double(0.001)));
-    oc.addDescription("tolerance", "Processing", "Use FLOAT as tolerance when checking for SUE stability");
+    oc.addDescription("tolerance", "Processing", "Use FLOAT as tolerance when checking for SUE stability or the relative UE gap");
 
     oc.doRegister("left-turn-penalty", new Option_Float(0.));
     oc.addDescription("left-turn-penalty", "Processing", "Use left-turn penalty FLOAT to calculate link travel time when searching routes");
@@ -52,6 +52,7 @@
 #include <utils/vehicle/AStarRouter.h>
 #include <utils/vehicle/CHRouter.h>
 #include <utils/vehicle/CHRouterWrapper.h>
+#include <utils/vehicle/ManyToManyRouter.h>
 #include <utils/xml/XMLSubSys.h>
 #include <od/ODCell.h>
 #include <od/ODDistrict.h>
@@ -167,6 +168,41 @@ writeInterval(OutputDevice& dev, const SUMOTime begin, const SUMOTime end, const
 }
 
 
+/**
+ * Writes the TAZ to TAZ travel times for the given intervals
+ */
+template<class PF>
+void
+writeTravelTimeMatrix(OutputDevice& dev, const std::vector<std::pair<SUMOTime, SUMOTime> >& intervals,
+                      const RONet& net, const ROVehicle* const veh, const int numThreads) {
+    std::vector<std::string> tazIDs;
+    std::vector<const ROEdge*> sources;
+    std::vector<const ROEdge*> sinks;
+    for (const auto& district : net.getDistricts()) {
+        tazIDs.push_back(district.first);
+        sources.push_back(net.getEdge(district.first + "-source"));
+        sinks.push_back(net.getEdge(district.first + "-sink"));
+    }
+    ManyToManyRouter<ROEdge, ROVehicle, PF> router(ROEdge::getAllEdges(), true, &ROEdge::getTravelTimeStatic, nullptr, numThreads);
+    std::vector<double> travelTimes;
+    for (const auto& interval : intervals) {
+        router.compute(sources, sinks, veh, interval.first, travelTimes);
+        dev.openTag(SUMO_TAG_INTERVAL).writeAttr(SUMO_ATTR_BEGIN, time2string(interval.first)).writeAttr(SUMO_ATTR_END, time2string(interval.second));
+        int index = 0;
+        for (const std::string& origin : tazIDs) {
+            for (const std::string& destination : tazIDs) {
+                const double traveltime = travelTimes[index++];
+                if (traveltime >= 0) {
+                    dev.openTag(SUMO_TAG_OD_PAIR).writeAttr(SUMO_ATTR_ORIGIN, origin).writeAttr(SUMO_ATTR_DESTINATION, destination);
+                    dev.writeAttr("traveltime", traveltime).closeTag();
+                }
+            }
+        }
+        dev.closeTag();
+    }
+}
+
+
 /**
  * Computes the routes saving them
  */
@@ -297,6 +333,8 @@ computeRoutes(RONet& net, OptionsCont& oc, ODMatrix& matrix) {
         const std::string assignMethod = oc.getString("assignment-method");
         if (assignMethod == "incremental") {
             a.incremental(oc.getInt("max-iterations"), oc.getBool("verbose"));
+        } else if (assignMethod == "UE") {
+            a.ue(oc.getInt("max-iterations"), oc.getFloat("tolerance"), oc.getBool("verbose"));
         } else if (assignMethod == "SUE") {
             a.sue(oc.getInt("max-iterations"), oc.getInt("max-inner-iterations"),
                   oc.getInt("paths"), oc.getFloat("paths.penalty"), oc.getFloat("tolerance"), oc.getString("route-choice-method"));
@@ -370,20 +408,34 @@ computeRoutes(RONet& net, OptionsCont& oc, ODMatrix& matrix) {
             }
             haveOutput = true;
         }
+        // the intervals for the edge and TAZ based outputs
+        std::vector<std::pair<SUMOTime, SUMOTime> > intervals;
+        if (oc.getBool("additive-traffic")) {
+            intervals.push_back(std::make_pair(begin, end));
+        } else {
+            SUMOTime lastCell = 0;
+            for (std::vector<ODCell*>::const_iterator i = matrix.getCells().begin(); i != matrix.getCells().end(); ++i) {
+                if ((*i)->end > lastCell) {
+                    lastCell = (*i)->end;
+                }
+            }
+            const SUMOTime interval = string2time(OptionsCont::getOptions().getString("aggregation-interval"));
+            for (SUMOTime start = begin; start < MIN2(end, lastCell); start += interval) {
+                intervals.push_back(std::make_pair(start, start + interval));
+            }
+        }
         if (OutputDevice::createDeviceByOption("netload-output", "meandata")) {
-            if (oc.getBool("additive-traffic")) {
-                writeInterval(OutputDevice::getDeviceByOption("netload-output"), begin, end, net, a.getDefaultVehicle());
+            for (const auto& interval : intervals) {
+                writeInterval(OutputDevice::getDeviceByOption("netload-output"), interval.first, interval.second, net, a.getDefaultVehicle());
+            }
+            haveOutput = true;
+        }
+        if (OutputDevice::createDeviceByOption("od-matrix-output", "odMatrix")) {
+            OutputDevice& matrixDev = OutputDevice::getDeviceByOption("od-matrix-output");
+            if (net.hasPermissions()) {
+                writeTravelTimeMatrix<prohibited_withPermissions<ROEdge, ROVehicle> >(matrixDev, intervals, net, a.getDefaultVehicle(), oc.getInt("routing-threads"));
             } else {
-                SUMOTime lastCell = 0;
-                for (std::vector<ODCell*>::const_iterator i = matrix.getCells().begin(); i != matrix.getCells().end(); ++i) {
-                    if ((*i)->end > lastCell) {
-                        lastCell = (*i)->end;
-                    }
-                }
-                const SUMOTime interval = string2time(OptionsCont::getOptions().getString("aggregation-interval"));
-                for (SUMOTime start = begin; start < MIN2(end, lastCell); start += interval) {
-                    writeInterval(OutputDevice::getDeviceByOption("netload-output"), start, start + interval, net, a.getDefaultVehicle());
-                }
+                writeTravelTimeMatrix<noProhibitions<ROEdge, ROVehicle> >(matrixDev, intervals, net, a.getDefaultVehicle(), oc.getInt("routing-threads"));
             }
             haveOutput = true;
         }
@@ -37,6 +37,11 @@
 #include <utils/common/FileHelpers.h>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/RandHelper.h>
+#include <microsim/MSJunction.h>
+#include <microsim/output/MSMeanData.h>
+#include <microsim/devices/MSDevice_BTreceiver.h>
+#include <microsim/devices/MSDevice_BTsender.h>
+#include <microsim/devices/MSDevice_Transportable.h>
 #include "MELoop.h"
 #include "MESegment.h"
 #include "MEVehicle.h"
@@ -45,7 +50,13 @@
 // ===========================================================================
 // method definitions
 // ===========================================================================
-MELoop::MELoop(const SUMOTime recheckInterval) : myFullRecheckInterval(recheckInterval), myLinkRecheckInterval(TIME2STEPS(1)) {
+MELoop::MELoop(const SUMOTime recheckInterval, const int numThreads) :
+    myFullRecheckInterval(recheckInterval), myLinkRecheckInterval(TIME2STEPS(1)),
+    myUseWindows(numThreads > 0), myLookahead(SUMOTime_MAX), myWindowEnd(SUMOTime_MIN)
+#ifdef HAVE_FOX
+    , myThreadPool(numThreads > 1 ? numThreads : 0)
+#endif
+{
 }
 
 MELoop::~MELoop() {
@@ -61,6 +72,10 @@ MELoop::~MELoop() {
 
 void
 MELoop::simulate(SUMOTime tMax) {
+    if (myUseWindows) {
+        simulateWindows(tMax);
+        return;
+    }
     while (!myLeaderCars.empty()) {
         const SUMOTime time = myLeaderCars.begin()->first;
         assert(time > tMax - DELTA_T);
@@ -77,6 +92,198 @@ MELoop::simulate(SUMOTime tMax) {
 }
 
 
+void
+MELoop::simulateWindows(SUMOTime tMax) {
+    if (myEdgeParents.size() < myEdges2FirstSegments.size()) {
+        myEdgeParents.resize(myEdges2FirstSegments.size(), -1);
+        myEdgeGroups.resize(myEdges2FirstSegments.size(), -1);
+    }
+    std::vector<int> affected;
+    std::vector<std::pair<MEVehicle*, int> > events; // vehicle and one of its affected edges
+    std::vector<bool> sequential;
+    while (!myLeaderCars.empty()) {
+        const SUMOTime time = myLeaderCars.begin()->first;
+        assert(time > tMax - DELTA_T);
+        if (time > tMax) {
+            return;
+        }
+        // no event within the window can trigger another one on a different segment before its end
+        myWindowEnd = MIN2(time + MAX2(myLookahead, SUMOTime(1)), tMax + 1);
+        std::map<SUMOTime, std::vector<MEVehicle*> >::iterator windowEnd = myLeaderCars.begin();
+        for (; windowEnd != myLeaderCars.end() && windowEnd->first < myWindowEnd; ++windowEnd) {
+            for (MEVehicle* const veh : windowEnd->second) {
+                affected.clear();
+                getAffectedEdges(veh, affected);
+                const int root = findGroupRoot(affected.front());
+                for (const int edge : affected) {
+                    myEdgeParents[findGroupRoot(edge)] = root;
+                }
+                events.push_back(std::make_pair(veh, root));
+                sequential.push_back(needsSequentialCheck(veh, affected));
+            }
+        }
+        // build the groups in the order of the global event list
+        int numParallel = 0;
+        for (int i = 0; i < (int)events.size(); ++i) {
+            const int root = findGroupRoot(events[i].second);
+            if (myEdgeGroups[root] < 0) {
+                myEdgeGroups[root] = (int)myGroups.size();
+                myGroups.push_back(EventGroup());
+                myGroups.back().sequential = false;
+                myGroups.back().active = false;
+            }
+            EventGroup& group = myGroups[myEdgeGroups[root]];
+            MEVehicle* const veh = events[i].first;
+            group.events[veh->getEventTime()].push_back(veh);
+            group.sequential |= sequential[i];
+        }
+        for (const int edge : myTouchedEdges) {
+            myEdgeGroups[edge] = myEdgeGroups[findGroupRoot(edge)];
+        }
+        for (const EventGroup& group : myGroups) {
+            if (!group.sequential) {
+                numParallel++;
+            }
+        }
+        myLeaderCars.erase(myLeaderCars.begin(), windowEnd);
+        bool processedParallel = false;
+#ifdef HAVE_FOX
+        if (myThreadPool.size() > 0 && numParallel > 1) {
+            for (int i = 0; i < myThreadPool.size(); ++i) {
+                myThreadPool.add(new GroupTask(*this, i, myThreadPool.size()), i);
+            }
+            myThreadPool.waitAll();
+            processedParallel = true;
+        }
+#endif
+        for (EventGroup& group : myGroups) {
+            if (group.sequential || !processedParallel) {
+                processGroup(group);
+            }
+        }
+        // hand back the remaining leader cars in a deterministic order
+        for (const EventGroup& group : myGroups) {
+            for (MEVehicle* const veh : group.pending) {
+                myLeaderCars[veh->getEventTime()].push_back(veh);
+            }
+        }
+        for (const int edge : myTouchedEdges) {
+            myEdgeParents[edge] = -1;
+            myEdgeGroups[edge] = -1;
+        }
+        myTouchedEdges.clear();
+        myGroups.clear();
+        events.clear();
+        sequential.clear();
+        myWindowEnd = SUMOTime_MIN;
+    }
+}
+
+
+void
+MELoop::processGroup(EventGroup& group) {
+    group.active = true;
+    while (!group.events.empty()) {
+        const std::vector<MEVehicle*> vehs = group.events.begin()->second;
+        group.events.erase(group.events.begin());
+        for (MEVehicle* const veh : vehs) {
+            checkCar(veh);
+        }
+    }
+    group.active = false;
+}
+
+
+#ifdef HAVE_FOX
+void
+MELoop::GroupTask::run(FXWorkerThread* /* context */) {
+    for (int i = myOffset; i < (int)myLoop.myGroups.size(); i += myStep) {
+        if (!myLoop.myGroups[i].sequential) {
+            myLoop.processGroup(myLoop.myGroups[i]);
+        }
+    }
+}
+#endif
+
+
+int
+MELoop::findGroupRoot(int edge) {
+    if (myEdgeParents[edge] < 0) {
+        myEdgeParents[edge] = edge;
+        myTouchedEdges.push_back(edge);
+        return edge;
+    }
+    while (myEdgeParents[edge] != edge) {
+        myEdgeParents[edge] = myEdgeParents[myEdgeParents[edge]];
+        edge = myEdgeParents[edge];
+    }
+    return edge;
+}
+
+
+void
+MELoop::getAffectedEdges(MEVehicle* veh, std::vector<int>& into) {
+    MESegment* const onSegment = veh->getSegment();
+    MESegment* const toSegment = nextSegment(onSegment, veh);
+    const MSEdge* const onEdge = onSegment != 0 ? &onSegment->getEdge() : veh->getEdge();
+    into.push_back(onEdge->getNumericalID());
+    // the link state of all incoming edges is shared via the junction
+    into.push_back(onEdge->getToJunction()->getIncoming().front()->getNumericalID());
+    if (!MESegment::isInvalid(toSegment)) {
+        const MSEdge& toEdge = toSegment->getEdge();
+        into.push_back(toEdge.getNumericalID());
+        into.push_back(toEdge.getToJunction()->getIncoming().front()->getNumericalID());
+        if (MSGlobals::gMesoLimitedJunctionControl) {
+            // the link penalty depends on the occupancy of the subsequent edges
+            for (const MSEdge* const succ : toEdge.getSuccessors()) {
+                into.push_back(succ->getNumericalID());
+            }
+        }
+    }
+}
+
+
+bool
+MELoop::needsSequentialCheck(MEVehicle* veh, const std::vector<int>& affected) const {
+    const MESegment* const onSegment = veh->getSegment();
+    if (MSGlobals::gMesoOvertaking || onSegment == 0 || veh->hasStops()) {
+        // overtaking needs the global random number generator, teleports and stops the vehicle control
+        return true;
+    }
+    // arrivals are reported to the vehicle control
+    const MSEdge* const next = veh->succEdge(1);
+    if (next == 0 || (onSegment->getNextSegment() == 0 && (next->isVaporizing() || veh->succEdge(2) == 0))) {
+        return true;
+    }
+    if (MSGlobals::gTimeToGridlock > 0) {
+        const SUMOTime blockedSince = veh->getBlockTime() == SUMOTime_MAX ? veh->getEventTime() : veh->getBlockTime();
+        if (myWindowEnd - blockedSince > MSGlobals::gTimeToGridlock) {
+            return true;
+        }
+    }
+    if (veh->getDevice(typeid(MSDevice_BTreceiver)) != 0 || veh->getDevice(typeid(MSDevice_BTsender)) != 0
+            || veh->getDevice(typeid(MSDevice_Transportable)) != 0) {
+        return true;
+    }
+    for (const int edge : affected) {
+        const MSEdge* const e = MSEdge::getAllEdges()[edge];
+        if (e->getToJunction()->getType() == NODETYPE_ALLWAY_STOP) {
+            // the tie breaker for all-way stops is random
+            return true;
+        }
+        for (const MESegment* s = myEdges2FirstSegments[edge]; s != 0; s = s->getNextSegment()) {
+            for (MSMoveReminder* const rem : s->getDetectors()) {
+                // only edge based data collectors may be used concurrently
+                if (dynamic_cast<MSMeanData::MeanDataValues*>(rem) == 0) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+
 bool
 MELoop::changeSegment(MEVehicle* veh, SUMOTime leaveTime, MESegment* const toSegment, const bool ignoreLink) {
     MESegment* const onSegment = veh->getSegment();
@@ -196,6 +403,35 @@ MELoop::teleportVehicle(MEVehicle* veh, MESegment* const toSegment) {
 
 void
 MELoop::addLeaderCar(MEVehicle* veh, MSLink* link) {
+    if (myWindowEnd != SUMOTime_MIN) {
+        const MSEdge* const edge = veh->getSegment() != 0 ? &veh->getSegment()->getEdge() : veh->getEdge();
+        const int groupIndex = myEdgeGroups[edge->getNumericalID()];
+        // the vehicle is always on an edge of the current group unless called by the main thread
+        if (groupIndex >= 0) {
+            EventGroup& group = myGroups[groupIndex];
+            bool local = false;
+            if (veh->getEventTime() < myWindowEnd && group.active) {
+                // the event may only be processed within this window if it does not reach into other groups
+                std::vector<int> affected;
+                getAffectedEdges(veh, affected);
+                local = true;
+                for (const int e : affected) {
+                    if (myEdgeGroups[e] != groupIndex) {
+                        local = false;
+                        break;
+                    }
+                }
+                local &= group.sequential || !needsSequentialCheck(veh, affected);
+            }
+            if (local) {
+                group.events[veh->getEventTime()].push_back(veh);
+            } else {
+                group.pending.push_back(veh);
+            }
+            setApproaching(veh, link);
+            return;
+        }
+    }
     myLeaderCars[veh->getEventTime()].push_back(veh);
     setApproaching(veh, link);
 }
@@ -216,6 +452,25 @@ MELoop::setApproaching(MEVehicle* veh, MSLink* link) {
 
 void
 MELoop::removeLeaderCar(MEVehicle* v) {
+    if (myWindowEnd != SUMOTime_MIN && v->getSegment() != 0) {
+        const int groupIndex = myEdgeGroups[v->getSegment()->getEdge().getNumericalID()];
+        if (groupIndex >= 0) {
+            EventGroup& group = myGroups[groupIndex];
+            std::vector<MEVehicle*>::iterator it = std::find(group.pending.begin(), group.pending.end(), v);
+            if (it != group.pending.end()) {
+                group.pending.erase(it);
+                return;
+            }
+            std::map<SUMOTime, std::vector<MEVehicle*> >::iterator events = group.events.find(v->getEventTime());
+            if (events != group.events.end()) {
+                it = std::find(events->second.begin(), events->second.end(), v);
+                if (it != events->second.end()) {
+                    events->second.erase(it);
+                    return;
+                }
+            }
+        }
+    }
     std::vector<MEVehicle*>& cands = myLeaderCars[v->getEventTime()];
     cands.erase(find(cands.begin(), cands.end(), v));
 }
@@ -256,6 +511,10 @@ MELoop::buildSegmentsFor(const MSEdge& e, const OptionsCont& oc) {
     const double length = e.getLength();
     int no = numSegmentsFor(length, oc.getFloat("meso-edgelength"));
     const double slength = length / (double)no;
+    const SUMOTime tauff = string2time(oc.getString("meso-tauff"));
+    const SUMOTime taufj = string2time(oc.getString("meso-taufj"));
+    const SUMOTime taujf = string2time(oc.getString("meso-taujf"));
+    const SUMOTime taujj = string2time(oc.getString("meso-taujj"));
     MESegment* newSegment = 0;
     MESegment* nextSegment = 0;
     bool multiQueue = oc.getBool("meso-multi-queue");
@@ -265,13 +524,17 @@ MELoop::buildSegmentsFor(const MSEdge& e, const OptionsCont& oc) {
         newSegment =
             new MESegment(id, e, nextSegment, slength,
                           e.getLanes()[0]->getSpeedLimit(), s,
-                          string2time(oc.getString("meso-tauff")), string2time(oc.getString("meso-taufj")),
-                          string2time(oc.getString("meso-taujf")), string2time(oc.getString("meso-taujj")),
+                          tauff, taufj, taujf, taujj,
                           oc.getFloat("meso-jam-threshold"), multiQueue, junctionControl);
         multiQueue = false;
         junctionControl = false;
         nextSegment = newSegment;
     }
+    // headways and free travel times bound the lookahead for parallel processing
+    myLookahead = MIN2(myLookahead, MIN2(MIN2(tauff, taufj), MIN2(taujf, taujj)) / (SUMOTime)e.getLanes().size());
+    if (e.getSpeedLimit() > 0) {
+        myLookahead = MIN2(myLookahead, TIME2STEPS(slength / e.getSpeedLimit()));
+    }
     while (e.getNumericalID() >= static_cast<int>(myEdges2FirstSegments.size())) {
         myEdges2FirstSegments.push_back(0);
     }
@@ -25,6 +25,9 @@
 
 #include <vector>
 #include <map>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -48,8 +51,11 @@ class OptionsCont;
  */
 class MELoop {
 public:
-    /// SUMO constructor
-    MELoop(const SUMOTime recheckInterval);
+    /** @brief SUMO constructor
+     * @param[in] recheckInterval the interval at which to recheck at full segments
+     * @param[in] numThreads the number of threads for parallel segment processing (0 disables the lookahead windows)
+     */
+    MELoop(const SUMOTime recheckInterval, const int numThreads = 0);
 
     ~MELoop();
 
@@ -106,6 +112,74 @@ public:
 
 
 private:
+    /**
+     * @struct EventGroup
+     * @brief The leader events of a lookahead window which share edges or junctions
+     *
+     * Different groups of the same window do not access common segments, links or
+     *  detectors and may therefore be processed concurrently.
+     */
+    struct EventGroup {
+        /// @brief the events of this group sorted by time (in the order of the global event list)
+        std::map<SUMOTime, std::vector<MEVehicle*> > events;
+        /// @brief leader cars which have to be handed back to the global event list after the window
+        std::vector<MEVehicle*> pending;
+        /// @brief whether the group accesses global state and thus has to be processed by the main thread
+        bool sequential;
+        /// @brief whether the group is currently being processed
+        bool active;
+    };
+
+#ifdef HAVE_FOX
+    /**
+     * @class GroupTask
+     * @brief A task which processes every n-th event group of the current window
+     */
+    class GroupTask : public FXWorkerThread::Task {
+    public:
+        GroupTask(MELoop& loop, const int offset, const int step)
+            : myLoop(loop), myOffset(offset), myStep(step) {}
+        void run(FXWorkerThread* context);
+    private:
+        MELoop& myLoop;
+        const int myOffset;
+        const int myStep;
+    private:
+        /// @brief Invalidated assignment operator.
+        GroupTask& operator=(const GroupTask&);
+    };
+#endif
+
+    /** @brief Perform simulation up to the given time using lookahead windows
+     *
+     * All leader events of a window (bounded by myLookahead) are partitioned into
+     *  groups of vehicles which share segments or junctions. Groups are processed
+     *  concurrently while groups accessing global state are processed afterwards
+     *  by the calling thread in a fixed order which keeps the results independent
+     *  of the number of threads.
+     *
+     * @param[in] tMax the end time for the sim step
+     */
+    void simulateWindows(SUMOTime tMax);
+
+    /// @brief processes the events of the given group until the end of the current window
+    void processGroup(EventGroup& group);
+
+    /** @brief Collects the numerical ids of all edges whose state may be accessed when checking the vehicle
+     *
+     * Junctions are represented by their first incoming edge.
+     *
+     * @param[in] veh The vehicle to check
+     * @param[out] into The container to add the edge ids to
+     */
+    void getAffectedEdges(MEVehicle* veh, std::vector<int>& into);
+
+    /// @brief whether checking the vehicle within the current window may touch state shared by all groups
+    bool needsSequentialCheck(MEVehicle* veh, const std::vector<int>& affected) const;
+
+    /// @brief finds the representative for the given edge id in the union-find structure of the current window
+    int findGroupRoot(int edge);
+
     /** @brief Check whether the vehicle may move
      *
      * This method is called when the vehicle reaches its event time and checks
@@ -151,6 +225,32 @@ private:
     /// @brief the interval at which to recheck at blocked junctions (<=0 means asap)
     const SUMOTime myLinkRecheckInterval;
 
+    /// @brief whether the simulation is run in lookahead windows
+    const bool myUseWindows;
+
+    /// @brief the minimum time between a segment change and any dependent event (minimum headway or segment travel time)
+    SUMOTime myLookahead;
+
+    /// @brief the (exclusive) end of the window currently being processed (SUMOTime_MIN outside of windows)
+    SUMOTime myWindowEnd;
+
+    /// @brief the event groups of the current window
+    std::vector<EventGroup> myGroups;
+
+    /// @brief mapping from edge ids to the group of the current window (-1 for unused edges)
+    std::vector<int> myEdgeGroups;
+
+    /// @brief union-find parents for edge ids of the current window (-1 for unused edges)
+    std::vector<int> myEdgeParents;
+
+    /// @brief the edge ids touched in the current window (for resetting)
+    std::vector<int> myTouchedEdges;
+
+#ifdef HAVE_FOX
+    /// @brief the pool of threads processing the event groups
+    FXWorkerThread::Pool myThreadPool;
+#endif
+
 private:
     /// @brief Invalidated copy constructor.
     MELoop(const MELoop&);
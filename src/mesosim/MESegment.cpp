@@ -101,6 +101,10 @@ MESegment::MESegment(const std::string& id,
     myLastMeanSpeedUpdate(SUMOTime_MIN) {
     myCarQues.push_back(std::vector<MEVehicle*>());
     myBlockTimes.push_back(-1);
+    if (useMultiQueue(multiQueue, parent) || myNextSegment == 0) {
+        // the successors may grow later on (TAZ sinks) so the tables below are only valid for these
+        myFollowerEdges.assign(parent.getSuccessors().begin(), parent.getSuccessors().end());
+    }
     if (useMultiQueue(multiQueue, parent)) {
         const std::vector<MSLane*>& lanes = parent.getLanes();
         while (myCarQues.size() < lanes.size()) {
@@ -112,9 +116,28 @@ MESegment::MESegment(const std::string& id,
             const std::vector<MSLane*>* const allowed = parent.allowedLanes(*edge);
             assert(allowed != 0);
             assert(allowed->size() > 0);
+            myFollowerOffsets.push_back((int)myFollowerQueues.size());
             for (std::vector<MSLane*>::const_iterator j = allowed->begin(); j != allowed->end(); ++j) {
                 std::vector<MSLane*>::const_iterator it = find(lanes.begin(), lanes.end(), *j);
-                myFollowerMap[edge].push_back((int)distance(lanes.begin(), it));
+                myFollowerQueues.push_back((int)distance(lanes.begin(), it));
+            }
+        }
+        myFollowerOffsets.push_back((int)myFollowerQueues.size());
+    }
+    if (myNextSegment == 0) {
+        // cache the links used by each queue for reaching each follower (see getLink)
+        const int numQueues = (int)myCarQues.size();
+        const std::vector<MSLane*>& lanes = parent.getLanes();
+        for (int i = 0; i < (int)parent.getNumSuccessors(); ++i) {
+            const MSEdge* const edge = parent.getSuccessors()[i];
+            for (int q = 0; q < numQueues; ++q) {
+                MSLink* link = findLink(lanes[q], edge);
+                for (std::vector<MSLane*>::const_iterator l = lanes.begin(); link == 0 && l != lanes.end(); ++l) {
+                    if ((*l) != lanes[q]) {
+                        link = findLink(*l, edge);
+                    }
+                }
+                myFollowerLinks.push_back(link);
             }
         }
     }
@@ -397,6 +420,30 @@ MESegment::getNextInsertionTime(SUMOTime earliestEntry) const {
 }
 
 
+int
+MESegment::getFollowerIndex(const MSEdge* succ) const {
+    // there are only a few successors so a linear scan of the contiguous vector is fastest
+    for (int i = 0; i < (int)myFollowerEdges.size(); ++i) {
+        if (myFollowerEdges[i] == succ) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+
+MSLink*
+MESegment::findLink(const MSLane* lane, const MSEdge* target) {
+    const MSLinkCont& links = lane->getLinkCont();
+    for (std::vector<MSLink*>::const_iterator j = links.begin(); j != links.end(); ++j) {
+        if (&(*j)->getLane()->getEdge() == target) {
+            return *j;
+        }
+    }
+    return 0;
+}
+
+
 MSLink*
 MESegment::getLink(const MEVehicle* veh, bool penalty) const {
     if (myJunctionControl || penalty) {
@@ -404,6 +451,12 @@ MESegment::getLink(const MEVehicle* veh, bool penalty) const {
         if (nextEdge == 0) {
             return 0;
         }
+        if (!myFollowerLinks.empty()) {
+            const int follower = getFollowerIndex(nextEdge);
+            if (follower >= 0) {
+                return myFollowerLinks[follower * myCarQues.size() + veh->getQueIndex()];
+            }
+        }
         // try to find any link leading to our next edge, start with the lane pointed to by the que index
         const MSLane* const bestLane = myEdge.getLanes()[veh->getQueIndex()];
         const MSLinkCont& links = bestLane->getLinkCont();
@@ -538,14 +591,14 @@ MESegment::receive(MEVehicle* veh, SUMOTime time, bool isDepart, bool afterTelep
     const double uspeed = MAX2(maxSpeedOnEdge, MESO_MIN_SPEED);
     int nextQueIndex = 0;
     if (myCarQues.size() > 1) {
-        const MSEdge* succ = veh->succEdge(1);
         // succ may be invalid if called from initialise() with an invalid route
-        if (succ != 0 && myFollowerMap.count(succ) > 0) {
-            const std::vector<int>& indices = myFollowerMap[succ];
-            nextQueIndex = indices[0];
-            for (std::vector<int>::const_iterator i = indices.begin() + 1; i != indices.end(); ++i) {
-                if (myCarQues[*i].size() < myCarQues[nextQueIndex].size()) {
-                    nextQueIndex = *i;
+        const int follower = getFollowerIndex(veh->succEdge(1));
+        if (follower >= 0) {
+            const int end = myFollowerOffsets[follower + 1];
+            nextQueIndex = myFollowerQueues[myFollowerOffsets[follower]];
+            for (int i = myFollowerOffsets[follower] + 1; i < end; ++i) {
+                if (myCarQues[myFollowerQueues[i]].size() < myCarQues[nextQueIndex].size()) {
+                    nextQueIndex = myFollowerQueues[i];
                 }
             }
         }
@@ -32,6 +32,7 @@
 // class declarations
 // ===========================================================================
 class MSEdge;
+class MSLane;
 class MSLink;
 class MSMoveReminder;
 class MSVehicleControl;
@@ -98,6 +99,11 @@ public:
      * @param[in] data The detector data to update
      */
     void prepareDetectorForWriting(MSMoveReminder& data);
+
+    /// @brief Returns the data collectors of this segment
+    inline const std::vector<MSMoveReminder*>& getDetectors() const {
+        return myDetectorData;
+    }
     /// @}
 
     /** @brief Returns whether the given vehicle would still fit into the segment
@@ -432,6 +438,12 @@ private:
     /// @brief whether the segment requires use of multiple queues
     static bool useMultiQueue(bool multiQueue, const MSEdge& parent);
 
+    /// @brief returns the index of the given edge among the successors known when building the segment (-1 if it is none of them)
+    int getFollowerIndex(const MSEdge* succ) const;
+
+    /// @brief returns the first link from the given lane to the target edge (0 if there is none)
+    static MSLink* findLink(const MSLane* lane, const MSEdge* target);
+
     /// @brief convert net time gap (leader back to follower front) to gross time gap (leader front to follower front)
     inline SUMOTime tauWithVehLength(SUMOTime tau, double lengthWithGap) const {
         return tau + (SUMOTime)(lengthWithGap / myTau_length);
@@ -486,8 +498,19 @@ private:
     /// @brief The car queues. Vehicles are inserted in the front and removed in the back
     Queues myCarQues;
 
-    /// @brief The follower edge to que index mapping for multi queue segments
-    std::map<const MSEdge*, std::vector<int> > myFollowerMap;
+    /** @brief The successors of the edge known at construction (multi queue and last segments only)
+     * @note the position of a successor is its index in the follower tables below */
+    std::vector<const MSEdge*> myFollowerEdges;
+
+    /** @brief The start of the que indices in myFollowerQueues for each successor of the edge (multi queue segments only)
+     * @note the last entry marks the end of the que indices of the last successor */
+    std::vector<int> myFollowerOffsets;
+
+    /// @brief The que indices which may be used to reach the successors of the edge (multi queue segments only)
+    std::vector<int> myFollowerQueues;
+
+    /// @brief The links used to reach each successor of the edge from each que (last segments only, indexed by successor * numQueues + que)
+    std::vector<MSLink*> myFollowerLinks;
 
     /// @brief The block times
     std::vector<SUMOTime> myBlockTimes;
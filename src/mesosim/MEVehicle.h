@@ -154,6 +154,11 @@ public:
      */
     bool isStopped() const;
 
+    /// @brief Returns whether the vehicle has any (remaining) stops
+    inline bool hasStops() const {
+        return !myStops.empty();
+    }
+
     /// @brief Returns the remaining stop duration for a stopped vehicle or 0
     SUMOTime remainingStopDuration() const {
         return 0;
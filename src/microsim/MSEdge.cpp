@@ -254,6 +254,8 @@ MSEdge::rebuildAllowedLanes() {
         myMinimumPermissions &= (*i)->getPermissions();
         myCombinedPermissions |= (*i)->getPermissions();
     }
+    // routes cached for the old permissions may use closed lanes
+    MSDevice_Routing::permissionsChanged();
 }
 
 
@@ -426,6 +426,15 @@ public:
         return MSNet::getInstance()->getTravelTime(edge, veh, time);
     }
 
+    /** @brief Returns the minimum travel time of the given edge
+     *
+     * This is a time independent lower bound for the efforts of the routing
+     *  device and is used for the landmark distances of the ALT router.
+     */
+    static inline double getMinimumTravelTimeStatic(const MSEdge* const edge, const SUMOVehicle* const veh, double /* time */) {
+        return edge->getMinimumTravelTime(veh);
+    }
+
     /** @brief Returns the averaged speed used by the routing device
      */
     double getRoutingSpeed() const;
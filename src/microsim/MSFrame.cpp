@@ -87,6 +87,8 @@ MSFrame::fillOptions() {
     oc.doRegister("additional-files", 'a', new Option_FileName());
     oc.addSynonyme("additional-files", "additional");
     oc.addDescription("additional-files", "Input", "Load further descriptions from FILE(s)");
+    oc.doRegister("additional-files.lazy-shapes", new Option_Bool(false));
+    oc.addDescription("additional-files.lazy-shapes", "Input", "Build polygons and POIs only when they are accessed (not in the GUI)");
 
     oc.doRegister("weight-files", 'w', new Option_FileName());
     oc.addSynonyme("weight-files", "weights");
@@ -153,6 +155,12 @@ MSFrame::fillOptions() {
     oc.addSynonyme("summary-output", "summary");
     oc.addDescription("summary-output", "Output", "Save aggregated vehicle departure info into FILE");
 
+    oc.doRegister("profiling-output", new Option_FileName());
+    oc.addDescription("profiling-output", "Output", "Save the time spent in the phases of the simulation step and hot path counters into FILE");
+
+    oc.doRegister("profiling-output.period", new Option_String("60", "TIME"));
+    oc.addDescription("profiling-output.period", "Output", "Aggregate the profiling output over the given TIME period");
+
     oc.doRegister("tripinfo-output", new Option_FileName());
     oc.addSynonyme("tripinfo-output", "tripinfo");
     oc.addDescription("tripinfo-output", "Output", "Save single vehicle trip info into FILE");
@@ -336,6 +344,9 @@ MSFrame::fillOptions() {
     oc.doRegister("pedestrian.striping.jamtime", new Option_String("300", "TIME"));
     oc.addDescription("pedestrian.striping.jamtime", "Processing", "Time in seconds after which pedestrians start squeezing through a jam when using model 'striping' (non-positive values disable squeezing)");
 
+    oc.doRegister("pedestrian.striping.threads", new Option_Integer(0));
+    oc.addDescription("pedestrian.striping.threads", "Processing", "The number of parallel execution threads used for moving pedestrians with model 'striping' (0 disables snapshot based processing)");
+
     oc.doRegister("pedestrian.remote.address", new Option_String("localhost:9000"));
     oc.addDescription("pedestrian.remote.address", "Processing", "The address (host:port) of the external simulation");
 
@@ -422,6 +433,8 @@ MSFrame::fillOptions() {
     oc.addDescription("meso-overtaking", "Mesoscopic", "Enable mesoscopic overtaking");
     oc.doRegister("meso-recheck", new Option_String("0", "TIME"));
     oc.addDescription("meso-recheck", "Mesoscopic", "Time interval for rechecking insertion into the next segment after failure");
+    oc.doRegister("meso-threads", new Option_Integer(0));
+    oc.addDescription("meso-threads", "Mesoscopic", "The number of parallel execution threads used for processing segment queues (0 disables lookahead processing)");
 
     // add rand options
     RandHelper::insertRandOptions();
@@ -476,6 +489,7 @@ MSFrame::buildStreams() {
     // standard outputs
     OutputDevice::createDeviceByOption("netstate-dump", "netstate", "netstate_file.xsd");
     OutputDevice::createDeviceByOption("summary-output", "summary", "summary_file.xsd");
+    OutputDevice::createDeviceByOption("profiling-output", "profiling", "profiling_file.xsd");
     OutputDevice::createDeviceByOption("tripinfo-output", "tripinfos", "tripinfo_file.xsd");
 
     //extended
@@ -514,6 +528,10 @@ MSFrame::checkOptions() {
         WRITE_ERROR("Invalid scaling factor.");
         ok = false;
     }
+    if (string2time(oc.getString("profiling-output.period")) <= 0) {
+        WRITE_ERROR("profiling-output.period must be positive.");
+        ok = false;
+    }
     if (oc.getBool("vehroute-output.exit-times") && !oc.isSet("vehroute-output")) {
         WRITE_ERROR("A vehroute-output file is needed for exit times.");
         ok = false;
@@ -533,6 +551,24 @@ MSFrame::checkOptions() {
     if (oc.getBool("meso-junction-control.limited") && !oc.getBool("meso-junction-control")) {
         oc.set("meso-junction-control", "true");
     }
+    if (oc.getInt("meso-threads") < 0) {
+        WRITE_ERROR("The number of mesoscopic threads must not be negative.");
+        ok = false;
+    }
+    if (oc.getInt("pedestrian.striping.threads") < 0) {
+        WRITE_ERROR("The number of pedestrian threads must not be negative.");
+        ok = false;
+    }
+#ifndef HAVE_FOX
+    if (oc.getInt("meso-threads") > 1) {
+        WRITE_ERROR("Parallel mesoscopic simulation is only possible when compiled with Fox.");
+        ok = false;
+    }
+    if (oc.getInt("pedestrian.striping.threads") > 1) {
+        WRITE_ERROR("Parallel pedestrian simulation is only possible when compiled with Fox.");
+        ok = false;
+    }
+#endif
     if (oc.getBool("mesosim") && oc.isDefault("pedestrian.model")) {
         oc.set("pedestrian.model", "nonInteracting");
     }
@@ -62,6 +62,7 @@
 #include "MSInsertionControl.h"
 #include "MSVehicleControl.h"
 #include "MSLeaderInfo.h"
+#include "MSProfiler.h"
 #include "MSVehicle.h"
 
 //#define DEBUG_INSERTION
@@ -176,6 +177,8 @@ MSLane::MSLane(const std::string& id, double maxSpeed, double length, MSEdge* co
     myLeaderInfoTmp(this, 0, 0),
     myLeaderInfoTime(SUMOTime_MIN),
     myFollowerInfoTime(SUMOTime_MIN),
+    myOccupancyVersion(0),
+    myOccupancyCacheVersion(-1),
     myLengthGeometryFactor(MAX2(POSITION_EPS, myShape.length()) / myLength), // factor should not be 0
     myIsRampAccel(isRampAccel),
     myRightSideOnEdge(0), // initialized in MSEdge::initialize
@@ -230,6 +233,7 @@ MSLane::setPartialOccupation(MSVehicle* v) {
 #endif
     // XXX update occupancy here?
     myPartialVehicles.push_back(v);
+    occupancyChanged();
     return myLength;
 }
 
@@ -244,6 +248,7 @@ MSLane::resetPartialOccupation(MSVehicle* v) {
     for (VehCont::iterator i = myPartialVehicles.begin(); i != myPartialVehicles.end(); ++i) {
         if (v == *i) {
             myPartialVehicles.erase(i);
+            occupancyChanged();
             // XXX update occupancy here?
             //std::cout << "    removed from myPartialVehicles\n";
             return;
@@ -293,6 +298,7 @@ MSLane::incorporateVehicle(MSVehicle* veh, double pos, double speed, double posL
     } else {
         myVehicles.insert(at, veh);
     }
+    occupancyChanged();
     myBruttoVehicleLengthSum += veh->getVehicleType().getLengthWithGap();
     myNettoVehicleLengthSum += veh->getVehicleType().getLength();
     myEdge->markDelayed();
@@ -975,20 +981,21 @@ const MSLeaderInfo&
 MSLane::getLastVehicleInformation(const MSVehicle* ego, double latOffset, double minPos, bool allowCached) const {
     if (myLeaderInfoTime < MSNet::getInstance()->getCurrentTimeStep() || ego != 0 || minPos > 0 || !allowCached) {
         myLeaderInfoTmp = MSLeaderInfo(this, ego, latOffset);
-        AnyVehicleIterator last = anyVehiclesBegin();
+        const Occupancy& occ = getOccupancy();
+        const int numVehicles = (int)occ.vehicles.size();
         int freeSublanes = 1; // number of sublanes for which no leader was found
         //if (ego->getID() == "disabled" && SIMTIME == 58) {
         //    std::cout << "DEBUG\n";
         //}
-        const MSVehicle* veh = *last;
-        while (freeSublanes > 0 && veh != 0) {
+        for (int i = 0; freeSublanes > 0 && i < numVehicles; ++i) {
+            const MSVehicle* const veh = occ.vehicles[i];
 #ifdef DEBUG_PLAN_MOVE
             if (DEBUG_COND2(ego)) {
                 gDebugFlag1 = true;
-                std::cout << "      getLastVehicleInformation lane=" << getID() << " minPos=" << minPos << " veh=" << veh->getID() << " pos=" << veh->getPositionOnLane(this)  << "\n";
+                std::cout << "      getLastVehicleInformation lane=" << getID() << " minPos=" << minPos << " veh=" << veh->getID() << " pos=" << occ.positions[i]  << "\n";
             }
 #endif
-            if (veh != ego && veh->getPositionOnLane(this) >= minPos) {
+            if (veh != ego && occ.positions[i] >= minPos) {
                 const double latOffset = veh->getLatOffset(this);
                 freeSublanes = myLeaderInfoTmp.addLeader(veh, true, latOffset);
 #ifdef DEBUG_PLAN_MOVE
@@ -997,7 +1004,6 @@ MSLane::getLastVehicleInformation(const MSVehicle* ego, double latOffset, double
                 }
 #endif
             }
-            veh = *(++last);
         }
         if (ego == 0 && minPos == 0) {
             // update cached value
@@ -1207,14 +1213,20 @@ MSLane::detectCollisions(SUMOTime timestep, const std::string& stage) {
         // (lanechanger-style)
 
         // XXX quick hack: check each in myVehicles against all others
-        for (AnyVehicleIterator veh = anyVehiclesBegin(); veh != anyVehiclesEnd(); ++veh) {
-            MSVehicle* follow = (MSVehicle*)*veh;
-            for (AnyVehicleIterator veh2 = anyVehiclesBegin(); veh2 != anyVehiclesEnd(); ++veh2) {
-                MSVehicle* lead = (MSVehicle*)*veh2;
+        // (the collision handling does not modify the vehicle containers but a
+        // collision stop may move a vehicle back, making the cached positions invalid)
+        const Occupancy& occ = getOccupancy();
+        const int numVehicles = (int)occ.vehicles.size();
+        for (int i = 0; i < numVehicles; ++i) {
+            MSVehicle* follow = occ.vehicles[i];
+            for (int j = 0; j < numVehicles; ++j) {
+                MSVehicle* lead = occ.vehicles[j];
                 if (lead == follow) {
                     continue;
                 }
-                if (lead->getPositionOnLane(this) < follow->getPositionOnLane(this)) {
+                if (myOccupancyCacheVersion == myOccupancyVersion
+                        ? occ.positions[j] < occ.positions[i]
+                        : lead->getPositionOnLane(this) < follow->getPositionOnLane(this)) {
                     continue;
                 }
                 if (detectCollisionBetween(timestep, stage, follow, lead, toRemove, toTeleport)) {
@@ -1291,10 +1303,11 @@ MSLane::detectCollisions(SUMOTime timestep, const std::string& stage) {
             std::cout << SIMTIME << " detect pedestrian collisions stage=" << stage << " lane=" << getID() << "\n";
         }
 #endif
-        AnyVehicleIterator v_end = anyVehiclesEnd();
-        for (AnyVehicleIterator it_v = anyVehiclesBegin(); it_v != v_end; ++it_v) {
-            const MSVehicle* v = *it_v;
-            const double back = v->getBackPositionOnLane(this);
+        const Occupancy& occ = getOccupancy();
+        const int numVehicles = (int)occ.vehicles.size();
+        for (int i = 0; i < numVehicles; ++i) {
+            const MSVehicle* v = occ.vehicles[i];
+            const double back = occ.backPositions[i];
             const double length = v->getVehicleType().getLength();
             const double right = v->getRightSideOnEdge(this) - getRightSideOnEdge();
             PersonDist leader = MSPModel::getModel()->nextBlocking(this, back, right, right + v->getVehicleType().getWidth());
@@ -1542,6 +1555,8 @@ MSLane::executeMovements(SUMOTime t, std::vector<MSLane*>& lanesWithVehiclesToIn
         const double length = veh->getVehicleType().getLengthWithGap();
         const double nettoLength = veh->getVehicleType().getLength();
         const bool moved = veh->executeMove();
+        occupancyChanged();
+        partialOccupancyChanged(veh);
         MSLane* const target = veh->getLane();
         if (veh->hasArrived()) {
             // vehicle has reached its arrival position
@@ -1597,6 +1612,7 @@ MSLane::executeMovements(SUMOTime t, std::vector<MSLane*>& lanesWithVehiclesToIn
         myNettoVehicleLengthSum -= nettoLength;
         ++i;
         i = VehCont::reverse_iterator(myVehicles.erase(i.base()));
+        occupancyChanged();
     }
     if (myVehicles.size() > 0) {
         if (MSGlobals::gTimeToGridlock > 0 || MSGlobals::gTimeToGridlockHighways > 0) {
@@ -1613,6 +1629,7 @@ MSLane::executeMovements(SUMOTime t, std::vector<MSLane*>& lanesWithVehiclesToIn
                     myBruttoVehicleLengthSum -= veh->getVehicleType().getLengthWithGap();
                     myNettoVehicleLengthSum -= veh->getVehicleType().getLength();
                     myVehicles.erase(myVehicles.end() - 1);
+                    occupancyChanged();
                     WRITE_WARNING("Teleporting vehicle '" + veh->getID() + "'; waited too long"
                                   + reason
                                   + (r2 ? " (highway)" : "")
@@ -1753,6 +1770,7 @@ MSLane::integrateNewVehicle(SUMOTime) {
         myEdge->markDelayed();
     }
     myVehBuffer.clear();
+    occupancyChanged();
     //std::cout << SIMTIME << " integrateNewVehicle lane=" << getID() << " myVehicles1=" << toString(myVehicles);
     if (MSGlobals::gLateralResolution > 0 || myNeighs.size() > 0) {
         sort(myVehicles.begin(), myVehicles.end(), vehicle_natural_position_sorter(this));
@@ -1770,6 +1788,7 @@ void
 MSLane::sortPartialVehicles() {
     if (myPartialVehicles.size() > 1) {
         sort(myPartialVehicles.begin(), myPartialVehicles.end(), vehicle_natural_position_sorter(this));
+        occupancyChanged();
     }
 }
 
@@ -1846,6 +1865,41 @@ MSLane::getLastAnyVehicle() const {
 }
 
 
+const MSLane::Occupancy&
+MSLane::getOccupancy() const {
+    if (myOccupancyCacheVersion != myOccupancyVersion) {
+        myOccupancy.vehicles.clear();
+        myOccupancy.positions.clear();
+        myOccupancy.backPositions.clear();
+        for (AnyVehicleIterator veh = anyVehiclesBegin(); veh != anyVehiclesEnd(); ++veh) {
+            // XXX refactor leaderInfo to use a const vehicle all the way through the call hierarchy
+            myOccupancy.vehicles.push_back((MSVehicle*)*veh);
+            myOccupancy.positions.push_back(veh->getPositionOnLane(this));
+            myOccupancy.backPositions.push_back(veh->getBackPositionOnLane(this));
+        }
+        myOccupancyCacheVersion = myOccupancyVersion;
+    }
+    return myOccupancy;
+}
+
+
+void
+MSLane::partialOccupancyChanged(const MSVehicle* veh) {
+    const std::vector<MSLane*>& further = veh->getFurtherLanes();
+    for (std::vector<MSLane*>::const_iterator i = further.begin(); i != further.end(); ++i) {
+        (*i)->occupancyChanged();
+    }
+    const MSAbstractLaneChangeModel& lcm = veh->getLaneChangeModel();
+    if (lcm.getShadowLane() != 0) {
+        lcm.getShadowLane()->occupancyChanged();
+    }
+    const std::vector<MSLane*>& shadowFurther = lcm.getShadowFurtherLanes();
+    for (std::vector<MSLane*>::const_iterator i = shadowFurther.begin(); i != shadowFurther.end(); ++i) {
+        (*i)->occupancyChanged();
+    }
+}
+
+
 MSVehicle*
 MSLane::getFirstAnyVehicle() const {
     MSVehicle* result = 0;
@@ -1973,6 +2027,7 @@ MSLane::swapAfterLaneChange(SUMOTime) {
     //if (getID() == "disabled_lane") std::cout << SIMTIME << " swapAfterLaneChange lane=" << getID() << " myVehicles=" << toString(myVehicles) << " myTmpVehicles=" << toString(myTmpVehicles) << "\n";
     myVehicles = myTmpVehicles;
     myTmpVehicles.clear();
+    occupancyChanged();
     // this needs to be done after finishing lane-changing for all lanes on the
     // current edge (MSLaneChanger::updateLanes())
     sortPartialVehicles();
@@ -1988,6 +2043,7 @@ MSLane::removeVehicle(MSVehicle* remVehicle, MSMoveReminder::Notification notifi
                 remVehicle->leaveLane(notification);
             }
             myVehicles.erase(it);
+            occupancyChanged();
             myBruttoVehicleLengthSum -= remVehicle->getVehicleType().getLengthWithGap();
             myNettoVehicleLengthSum -= remVehicle->getVehicleType().getLength();
             break;
@@ -2079,6 +2135,7 @@ MSLane::getMaximumBrakeDist() const {
 
 std::pair<MSVehicle* const, double>
 MSLane::getLeader(const MSVehicle* veh, const double vehPos, const std::vector<MSLane*>& bestLaneConts, double dist, bool checkTmpVehicles) const {
+    MSProfiler::count(MSProfiler::COUNTER_LEADER_QUERIES);
     // get the leading vehicle for (shadow) veh
     // XXX this only works as long as all lanes of an edge have equal length
 #ifdef DEBUG_CONTEXT
@@ -2103,20 +2160,17 @@ MSLane::getLeader(const MSVehicle* veh, const double vehPos, const std::vector<M
             }
         }
     } else {
-        for (AnyVehicleIterator last = anyVehiclesBegin(); last != anyVehiclesEnd(); ++last) {
-            // XXX refactor leaderInfo to use a const vehicle all the way through the call hierarchy
-            MSVehicle* pred = (MSVehicle*)*last;
-            if (pred == veh) {
-                continue;
-            }
+        const Occupancy& occ = getOccupancy();
+        const int numVehicles = (int)occ.vehicles.size();
+        for (int i = 0; i < numVehicles; ++i) {
+            if (occ.positions[i] > vehPos + NUMERICAL_EPS && occ.vehicles[i] != veh) {
 #ifdef DEBUG_CONTEXT
-            if (DEBUG_COND2(veh)) {
-                std::cout << "   getLeader lane=" << getID() << " ego=" << veh->getID() << " egoPos=" << vehPos
-                          << " pred=" << pred->getID() << " predPos=" << pred->getPositionOnLane(this) << " predBack=" << pred->getBackPositionOnLane(this) << "\n";
-            }
+                if (DEBUG_COND2(veh)) {
+                    std::cout << "   getLeader lane=" << getID() << " ego=" << veh->getID() << " egoPos=" << vehPos
+                              << " pred=" << occ.vehicles[i]->getID() << " predPos=" << occ.positions[i] << " predBack=" << occ.backPositions[i] << "\n";
+                }
 #endif
-            if (pred->getPositionOnLane(this) > vehPos + NUMERICAL_EPS) {
-                return std::pair<MSVehicle* const, double>(pred, pred->getBackPositionOnLane(this) - veh->getVehicleType().getMinGap() - vehPos);
+                return std::pair<MSVehicle* const, double>(occ.vehicles[i], occ.backPositions[i] - veh->getVehicleType().getMinGap() - vehPos);
             }
         }
     }
@@ -2827,17 +2881,19 @@ MSLane::getFollowersOnConsecutive(const MSVehicle* ego, double backOffset,
     const double egoLatDist = ego->getLane()->getRightSideOnEdge() - getRightSideOnEdge();
     MSCriticalFollowerDistanceInfo result(this, allSublanes ? 0 : ego, allSublanes ? 0 : egoLatDist);
     /// XXX iterate in reverse and abort when there are no more freeSublanes
-    for (AnyVehicleIterator last = anyVehiclesBegin(); last != anyVehiclesEnd(); ++last) {
-        const MSVehicle* veh = *last;
+    const Occupancy& occ = getOccupancy();
+    const int numVehicles = (int)occ.vehicles.size();
+    for (int i = 0; i < numVehicles; ++i) {
+        const MSVehicle* veh = occ.vehicles[i];
 #ifdef DEBUG_CONTEXT
         if (DEBUG_COND2(ego)) {
-            std::cout << "  veh=" << veh->getID() << " lane=" << veh->getLane()->getID() << " pos=" << veh->getPositionOnLane(this) << "\n";
+            std::cout << "  veh=" << veh->getID() << " lane=" << veh->getLane()->getID() << " pos=" << occ.positions[i] << "\n";
         }
 #endif
-        if (veh != ego && veh->getPositionOnLane(this) <= egoPos) {
+        if (occ.positions[i] <= egoPos && veh != ego) {
             //const double latOffset = veh->getLane()->getRightSideOnEdge() - getRightSideOnEdge();
             const double latOffset = veh->getLatOffset(this);
-            const double dist = backOffset - veh->getPositionOnLane(this) - veh->getVehicleType().getMinGap();
+            const double dist = backOffset - occ.positions[i] - veh->getVehicleType().getMinGap();
             result.addFollower(veh, ego, dist, latOffset);
 #ifdef DEBUG_CONTEXT
             if (DEBUG_COND2(ego)) {
@@ -82,6 +82,17 @@ public:
     /// Container for vehicles.
     typedef std::vector<MSVehicle*> VehCont;
 
+    /** @brief The vehicles touching the lane in downstream order (as given by AnyVehicleIterator)
+     *         together with their positions on the lane, stored as contiguous arrays
+     */
+    struct Occupancy {
+        std::vector<MSVehicle*> vehicles;
+        /// @brief front positions on this lane
+        std::vector<double> positions;
+        /// @brief back positions on this lane
+        std::vector<double> backPositions;
+    };
+
     /** Function-object in order to find the vehicle, that has just
         passed the detector. */
     struct VehPosition : public std::binary_function < const MSVehicle*, double, bool > {
@@ -408,6 +419,19 @@ public:
         return AnyVehicleIterator(this, -1, -1, -1, -1, false);
     }
 
+    /** @brief Returns the positions of all vehicles touching this lane in downstream order
+     * @note The arrays are rebuilt lazily after the vehicles on this lane changed (see occupancyChanged)
+     */
+    const Occupancy& getOccupancy() const;
+
+    /// @brief invalidates the occupancy of this lane (called whenever vehicles touching it were moved, added or removed)
+    void occupancyChanged() {
+        myOccupancyVersion++;
+    }
+
+    /// @brief invalidates the occupancy of all lanes the given vehicle touches partially
+    static void partialOccupancyChanged(const MSVehicle* veh);
+
     /** @brief Allows to use the container for microsimulation again
      */
     virtual void releaseVehicles() const { }
@@ -1256,6 +1280,13 @@ protected:
     /// @brief time step for which myFollowerInfo was last updated
     mutable SUMOTime myFollowerInfoTime;
 
+    /// @brief the positions of all vehicles touching this lane (cached)
+    mutable Occupancy myOccupancy;
+    /// @brief counter of changes to the vehicles touching this lane and their positions
+    long long myOccupancyVersion;
+    /// @brief the value of myOccupancyVersion for which myOccupancy was last updated
+    mutable long long myOccupancyCacheVersion;
+
     /// @brief precomputed myShape.length / myLength
     const double myLengthGeometryFactor;
 
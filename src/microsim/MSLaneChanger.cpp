@@ -1243,6 +1243,10 @@ MSLaneChanger::changeOpposite(std::pair<MSVehicle*, double> leader) {
         if (!isOpposite) {
             vehicle->myState.myBackPos = source->getOppositePos(vehicle->myState.myBackPos);
         }
+        // the positions were transformed for the opposite direction
+        source->occupancyChanged();
+        opposite->occupancyChanged();
+        MSLane::partialOccupancyChanged(vehicle);
 #ifdef DEBUG_CHANGE_OPPOSITE
         if (DEBUG_COND) {
             std::cout << SIMTIME << " changing to opposite veh=" << vehicle->getID() << " dir=" << direction << " opposite=" << Named::getIDSecure(opposite) << " state=" << state << "\n";
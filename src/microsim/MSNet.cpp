@@ -56,6 +56,7 @@
 #include <utils/shapes/ShapeContainer.h>
 #include <utils/vehicle/DijkstraRouter.h>
 #include <utils/vehicle/AStarRouter.h>
+#include <utils/vehicle/ManyToManyRouter.h>
 #include <utils/vehicle/IntermodalRouter.h>
 #include <utils/vehicle/PedestrianRouter.h>
 #include <utils/xml/SUMORouteLoaderControl.h>
@@ -103,6 +104,7 @@
 #include "MSFrame.h"
 #include "MSParkingArea.h"
 #include "MSStoppingPlace.h"
+#include "MSProfiler.h"
 #include "MSNet.h"
 
 
@@ -176,6 +178,7 @@ MSNet::MSNet(MSVehicleControl* vc, MSEventControl* beginOfTimestepEvents,
     myRouterTT(0),
     myRouterEffort(0),
     myPedestrianRouter(0),
+    myMatrixRouterTT(0),
     myIntermodalRouter(0) {
     if (myInstance != 0) {
         throw ProcessError("A network was already constructed.");
@@ -196,7 +199,7 @@ MSNet::MSNet(MSVehicleControl* vc, MSEventControl* beginOfTimestepEvents,
     myPersonControl = 0;
     myContainerControl = 0;
     myEdgeWeights = 0;
-    myShapeContainer = shapeCont == 0 ? new ShapeContainer() : shapeCont;
+    myShapeContainer = shapeCont == 0 ? new ShapeContainer(oc.getBool("additional-files.lazy-shapes")) : shapeCont;
 
     myBeginOfTimestepEvents = beginOfTimestepEvents;
     myEndOfTimestepEvents = endOfTimestepEvents;
@@ -204,7 +207,7 @@ MSNet::MSNet(MSVehicleControl* vc, MSEventControl* beginOfTimestepEvents,
     myLanesRTree.first = false;
 
     if (MSGlobals::gUseMesoSim) {
-        MSGlobals::gMesoNet = new MELoop(string2time(oc.getString("meso-recheck")));
+        MSGlobals::gMesoNet = new MELoop(string2time(oc.getString("meso-recheck")), oc.getInt("meso-threads"));
     }
     myInstance = this;
 }
@@ -238,6 +241,7 @@ MSNet::closeBuilding(const OptionsCont& oc, MSEdgeControl* edges, MSJunctionCont
     if (myLogExecutionTime) {
         mySimBeginMillis = SysUtils::getCurrentMillis();
     }
+    MSProfiler::init(oc);
     myHasInternalLinks = hasInternalLinks;
     if (hasNeighs && MSGlobals::gLateralResolution > 0) {
         WRITE_WARNING("Opposite direction driving does not work together with the sublane model.");
@@ -275,6 +279,7 @@ MSNet::~MSNet() {
     delete myEdgeWeights;
     delete myRouterTT;
     delete myRouterEffort;
+    delete myMatrixRouterTT;
     if (myPedestrianRouter != nullptr) {
         delete myPedestrianRouter;
     }
@@ -370,6 +375,7 @@ MSNet::closeSimulation(SUMOTime start) {
     if (OptionsCont::getOptions().isSet("chargingstations-output")) {
         writeChargingStationOutput();
     }
+    MSProfiler::close(myStep);
     if (myLogExecutionTime) {
         long duration = SysUtils::getCurrentMillis() - mySimBeginMillis;
         std::ostringstream msg;
@@ -419,6 +425,7 @@ MSNet::closeSimulation(SUMOTime start) {
         }
         if (OptionsCont::getOptions().getBool("duration-log.statistics")) {
             msg << MSDevice_Tripinfo::printStatistics();
+            msg << MSProfiler::printStatistics();
         }
         WRITE_MESSAGE(msg.str());
     }
@@ -435,6 +442,7 @@ MSNet::simulationStep() {
     if (myLogExecutionTime) {
         myTraCIStepDuration = SysUtils::getCurrentMillis();
     }
+    MSProfiler::beginStep();
     TraCIServer* t = TraCIServer::getInstance();
     if (t != 0 && !t->isEmbedded()) {
         t->processCommandsUntilSimStep(myStep);
@@ -447,6 +455,7 @@ MSNet::simulationStep() {
     if (myLogExecutionTime) {
         myTraCIStepDuration = SysUtils::getCurrentMillis() - myTraCIStepDuration;
     }
+    MSProfiler::lap(MSProfiler::PHASE_TRACI);
 #ifdef DEBUG_SIMSTEP
     std::cout << SIMTIME << ": TraCI target time: " << t->getTargetTime() << std::endl;
 #endif
@@ -463,18 +472,24 @@ MSNet::simulationStep() {
     if (myStateDumpPeriod > 0 && myStep % myStateDumpPeriod == 0) {
         MSStateHandler::saveState(myStateDumpPrefix + "_" + time2string(myStep) + myStateDumpSuffix, myStep);
     }
+    MSProfiler::lap(MSProfiler::PHASE_OUTPUT);
     myBeginOfTimestepEvents->execute(myStep);
+    MSProfiler::lap(MSProfiler::PHASE_EVENTS);
 #ifdef HAVE_FOX
     MSDevice_Routing::waitForAll();
+    MSProfiler::lap(MSProfiler::PHASE_ROUTING);
 #endif
     if (MSGlobals::gCheck4Accidents) {
         myEdges->detectCollisions(myStep, STAGE_EVENTS);
+        MSProfiler::lap(MSProfiler::PHASE_COLLISIONS);
     }
     // check whether the tls programs need to be switched
     myLogics->check2Switch(myStep);
+    MSProfiler::lap(MSProfiler::PHASE_TLS);
 
     if (MSGlobals::gUseMesoSim) {
         MSGlobals::gMesoNet->simulate(myStep);
+        MSProfiler::lap(MSProfiler::PHASE_MESO);
     } else {
         // assure all lanes with vehicles are 'active'
         myEdges->patchActiveLanes();
@@ -482,21 +497,27 @@ MSNet::simulationStep() {
         // compute safe velocities for all vehicles for the next few lanes
         // also register ApproachingVehicleInformation for all links
         myEdges->planMovements(myStep);
+        MSProfiler::lap(MSProfiler::PHASE_PLAN_MOVEMENTS);
 
         // decide right-of-way and execute movements
         myEdges->executeMovements(myStep);
+        MSProfiler::lap(MSProfiler::PHASE_EXECUTE_MOVEMENTS);
         if (MSGlobals::gCheck4Accidents) {
             myEdges->detectCollisions(myStep, STAGE_MOVEMENTS);
+            MSProfiler::lap(MSProfiler::PHASE_COLLISIONS);
         }
 
         // vehicles may change lanes
         myEdges->changeLanes(myStep);
+        MSProfiler::lap(MSProfiler::PHASE_CHANGE_LANES);
 
         if (MSGlobals::gCheck4Accidents) {
             myEdges->detectCollisions(myStep, STAGE_LANECHANGE);
+            MSProfiler::lap(MSProfiler::PHASE_COLLISIONS);
         }
     }
     loadRoutes();
+    MSProfiler::lap(MSProfiler::PHASE_LOAD_ROUTES);
 
     // persons
     if (myPersonControl != 0 && myPersonControl->hasTransportables()) {
@@ -506,21 +527,28 @@ MSNet::simulationStep() {
     if (myContainerControl != 0 && myContainerControl->hasTransportables()) {
         myContainerControl->checkWaiting(this, myStep);
     }
+    MSProfiler::lap(MSProfiler::PHASE_TRANSPORTABLES);
     // insert vehicles
     myInserter->determineCandidates(myStep);
     myInsertionEvents->execute(myStep);
+    MSProfiler::lap(MSProfiler::PHASE_INSERTION);
 #ifdef HAVE_FOX
     MSDevice_Routing::waitForAll();
+    MSProfiler::lap(MSProfiler::PHASE_ROUTING);
 #endif
     myInserter->emitVehicles(myStep);
+    MSProfiler::lap(MSProfiler::PHASE_INSERTION);
     if (MSGlobals::gCheck4Accidents) {
         //myEdges->patchActiveLanes(); // @note required to detect collisions on lanes that were empty before insertion. wasteful?
         myEdges->detectCollisions(myStep, STAGE_INSERTIONS);
+        MSProfiler::lap(MSProfiler::PHASE_COLLISIONS);
     }
     MSVehicleTransfer::getInstance()->checkInsertions(myStep);
+    MSProfiler::lap(MSProfiler::PHASE_INSERTION);
 
     // execute endOfTimestepEvents
     myEndOfTimestepEvents->execute(myStep);
+    MSProfiler::lap(MSProfiler::PHASE_EVENTS);
 
     if (TraCIServer::getInstance() != 0) {
         if (myLogExecutionTime) {
@@ -530,9 +558,12 @@ MSNet::simulationStep() {
         if (myLogExecutionTime) {
             myTraCIStepDuration += SysUtils::getCurrentMillis();
         }
+        MSProfiler::lap(MSProfiler::PHASE_TRACI);
     }
     // update and write (if needed) detector values
     writeOutput();
+    MSProfiler::lap(MSProfiler::PHASE_OUTPUT);
+    MSProfiler::endStep(myStep);
 
     if (myLogExecutionTime) {
         mySimStepDuration = SysUtils::getCurrentMillis() - mySimStepDuration;
@@ -613,6 +644,7 @@ MSNet::clearAll() {
     MSDevice_BTsender::cleanup();
     MSDevice_SSM::cleanup();
     MSStopOut::cleanup();
+    MSProfiler::clear();
     TraCIServer* t = TraCIServer::getInstance();
     if (t != 0) {
         t->cleanup();
@@ -912,6 +944,16 @@ MSNet::getPedestrianRouter(const MSEdgeVector& prohibited) const {
 }
 
 
+ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >&
+MSNet::getMatrixRouterTT() const {
+    if (myMatrixRouterTT == 0) {
+        myMatrixRouterTT = new ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+            MSEdge::getAllEdges(), true, &MSNet::getTravelTime, nullptr, OptionsCont::getOptions().getInt("device.rerouting.threads"));
+    }
+    return *myMatrixRouterTT;
+}
+
+
 MSNet::MSIntermodalRouter&
 MSNet::getIntermodalRouter(const MSEdgeVector& prohibited) const {
     if (myIntermodalRouter == 0) {
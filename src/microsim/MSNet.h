@@ -72,6 +72,8 @@ template<class E, class L, class N, class V>
 class IntermodalRouter;
 template<class E, class L, class N, class V>
 class PedestrianRouter;
+template<class E, class V, class PF>
+class ManyToManyRouter;
 
 
 // ===========================================================================
@@ -571,6 +573,7 @@ public:
     SUMOAbstractRouter<MSEdge, SUMOVehicle>& getRouterEffort(
         const MSEdgeVector& prohibited = MSEdgeVector()) const;
     MSPedestrianRouter& getPedestrianRouter(const MSEdgeVector& prohibited = MSEdgeVector()) const;
+    ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >& getMatrixRouterTT() const;
     MSIntermodalRouter& getIntermodalRouter(const MSEdgeVector& prohibited = MSEdgeVector()) const;
 
     static void adaptIntermodalRouter(MSIntermodalRouter& router);
@@ -729,6 +732,7 @@ protected:
     mutable SUMOAbstractRouter<MSEdge, SUMOVehicle>* myRouterTT;
     mutable SUMOAbstractRouter<MSEdge, SUMOVehicle>* myRouterEffort;
     mutable MSPedestrianRouter* myPedestrianRouter;
+    mutable ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >* myMatrixRouterTT;
     mutable MSIntermodalRouter* myIntermodalRouter;
 
 
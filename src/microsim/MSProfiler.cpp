@@ -0,0 +1,207 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2003-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    MSProfiler.cpp
+/// @author  agent
+/// @date    2026-10-18
+/// @version $Id$
+///
+// Per-phase timers and hot path counters for the simulation step
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <config.h>
+
+#include <sstream>
+#include <iomanip>
+#include <utils/common/ToString.h>
+#include <utils/options/OptionsCont.h>
+#include <utils/iodevices/OutputDevice.h>
+#include "MSProfiler.h"
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+bool MSProfiler::myAmEnabled = false;
+MSProfiler::Clock::time_point MSProfiler::myLastLap;
+long long MSProfiler::myNanos[PHASE_NUMBER];
+long long MSProfiler::myCounts[COUNTER_NUMBER];
+long long MSProfiler::myWrittenNanos[PHASE_NUMBER];
+long long MSProfiler::myWrittenCounts[COUNTER_NUMBER];
+OutputDevice* MSProfiler::myOutput = 0;
+SUMOTime MSProfiler::myPeriod = 0;
+SUMOTime MSProfiler::myIntervalBegin = 0;
+int MSProfiler::myIntervalSteps = 0;
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+void
+MSProfiler::init(const OptionsCont& oc) {
+    clear();
+    if (oc.isSet("profiling-output")) {
+        myAmEnabled = true;
+        myOutput = &OutputDevice::getDeviceByOption("profiling-output");
+        myPeriod = string2time(oc.getString("profiling-output.period"));
+    }
+    myIntervalBegin = string2time(oc.getString("begin"));
+}
+
+
+void
+MSProfiler::clear() {
+    myAmEnabled = false;
+    myOutput = 0;
+    myPeriod = 0;
+    myIntervalBegin = 0;
+    myIntervalSteps = 0;
+    for (int i = 0; i < PHASE_NUMBER; i++) {
+        myNanos[i] = 0;
+        myWrittenNanos[i] = 0;
+    }
+    for (int i = 0; i < COUNTER_NUMBER; i++) {
+        myCounts[i] = 0;
+        myWrittenCounts[i] = 0;
+    }
+}
+
+
+void
+MSProfiler::endStep(SUMOTime step) {
+    myIntervalSteps++;
+    if (myOutput != 0 && step + DELTA_T - myIntervalBegin >= myPeriod) {
+        writeInterval(*myOutput, step + DELTA_T);
+    }
+}
+
+
+void
+MSProfiler::close(SUMOTime step) {
+    if (myOutput != 0 && myIntervalSteps > 0) {
+        writeInterval(*myOutput, step);
+    }
+}
+
+
+void
+MSProfiler::writeInterval(OutputDevice& dev, SUMOTime end) {
+    dev.openTag("interval");
+    dev.writeAttr("begin", time2string(myIntervalBegin));
+    dev.writeAttr("end", time2string(end));
+    dev.writeAttr("steps", myIntervalSteps);
+    for (int i = 0; i < PHASE_NUMBER; i++) {
+        dev.writeAttr(getName((Phase)i), (double)(myNanos[i] - myWrittenNanos[i]) / 1e6);
+        myWrittenNanos[i] = myNanos[i];
+    }
+    for (int i = 0; i < COUNTER_NUMBER; i++) {
+        dev.writeAttr(getName((Counter)i), myCounts[i] - myWrittenCounts[i]);
+        myWrittenCounts[i] = myCounts[i];
+    }
+    dev.closeTag();
+    myIntervalBegin = end;
+    myIntervalSteps = 0;
+}
+
+
+bool
+MSProfiler::getValue(const std::string& name, double& value) {
+    for (int i = 0; i < PHASE_NUMBER; i++) {
+        if (name == getName((Phase)i)) {
+            value = (double)myNanos[i] / 1e6;
+            return true;
+        }
+    }
+    for (int i = 0; i < COUNTER_NUMBER; i++) {
+        if (name == getName((Counter)i)) {
+            value = (double)myCounts[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+
+std::string
+MSProfiler::printStatistics() {
+    std::ostringstream msg;
+    if (myAmEnabled) {
+        msg << "Step phases (ms):\n";
+        msg.setf(std::ios::fixed, std::ios::floatfield);
+        msg << std::setprecision(3);
+        for (int i = 0; i < PHASE_NUMBER; i++) {
+            if (myNanos[i] > 0) {
+                msg << " " << getName((Phase)i) << ": " << (double)myNanos[i] / 1e6 << "\n";
+            }
+        }
+    }
+    msg << "Hot path counters:\n";
+    for (int i = 0; i < COUNTER_NUMBER; i++) {
+        msg << " " << getName((Counter)i) << ": " << myCounts[i] << "\n";
+    }
+    return msg.str();
+}
+
+
+const char*
+MSProfiler::getName(Phase phase) {
+    switch (phase) {
+        case PHASE_TRACI:
+            return "traci";
+        case PHASE_EVENTS:
+            return "events";
+        case PHASE_ROUTING:
+            return "routingWait";
+        case PHASE_TLS:
+            return "tlsSwitch";
+        case PHASE_MESO:
+            return "meso";
+        case PHASE_PLAN_MOVEMENTS:
+            return "planMovements";
+        case PHASE_EXECUTE_MOVEMENTS:
+            return "executeMovements";
+        case PHASE_CHANGE_LANES:
+            return "changeLanes";
+        case PHASE_COLLISIONS:
+            return "collisions";
+        case PHASE_LOAD_ROUTES:
+            return "loadRoutes";
+        case PHASE_TRANSPORTABLES:
+            return "transportables";
+        case PHASE_INSERTION:
+            return "insertion";
+        case PHASE_OUTPUT:
+            return "output";
+        default:
+            return "unknown";
+    }
+}
+
+
+const char*
+MSProfiler::getName(Counter counter) {
+    switch (counter) {
+        case COUNTER_LEADER_QUERIES:
+            return "leaderQueries";
+        case COUNTER_LINK_CHECKS:
+            return "linkChecks";
+        case COUNTER_ROUTER_CALLS:
+            return "routerCalls";
+        default:
+            return "unknown";
+    }
+}
+
+
+/****************************************************************************/
+
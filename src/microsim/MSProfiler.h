@@ -0,0 +1,188 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2003-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    MSProfiler.h
+/// @author  agent
+/// @date    2026-10-18
+/// @version $Id$
+///
+// Per-phase timers and hot path counters for the simulation step
+/****************************************************************************/
+#ifndef MSProfiler_h
+#define MSProfiler_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <config.h>
+
+#include <chrono>
+#include <string>
+#include <utils/common/SUMOTime.h>
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class OptionsCont;
+class OutputDevice;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MSProfiler
+ * @brief Collects the time spent in the phases of MSNet::simulationStep
+ *
+ * The step is split into phases by calling lap() after each of them, which
+ *  attributes the time since the previous lap (or beginStep) to the given
+ *  phase. Timing is only active if profiling-output is set or TraCI asked
+ *  for it, counters are always collected since they only cost an increment.
+ *
+ * All methods are meant to be called from the simulation thread only.
+ */
+class MSProfiler {
+public:
+    /// @brief the phases of a simulation step
+    enum Phase {
+        PHASE_TRACI = 0,
+        PHASE_EVENTS,
+        PHASE_ROUTING,
+        PHASE_TLS,
+        PHASE_MESO,
+        PHASE_PLAN_MOVEMENTS,
+        PHASE_EXECUTE_MOVEMENTS,
+        PHASE_CHANGE_LANES,
+        PHASE_COLLISIONS,
+        PHASE_LOAD_ROUTES,
+        PHASE_TRANSPORTABLES,
+        PHASE_INSERTION,
+        PHASE_OUTPUT,
+        PHASE_NUMBER
+    };
+
+    /// @brief the counted hot path operations
+    enum Counter {
+        COUNTER_LEADER_QUERIES = 0,
+        COUNTER_LINK_CHECKS,
+        COUNTER_ROUTER_CALLS,
+        COUNTER_NUMBER
+    };
+
+    /// @brief initializes the profiler from the options (profiling-output)
+    static void init(const OptionsCont& oc);
+
+    /// @brief resets all timers and counters and disables timing
+    static void clear();
+
+    /// @brief switches timing on (e.g. on request via TraCI)
+    static void enable() {
+        if (!myAmEnabled) {
+            // the current step is measured from now on
+            myLastLap = Clock::now();
+            myAmEnabled = true;
+        }
+    }
+
+    /// @brief whether phase timing is active
+    static bool isEnabled() {
+        return myAmEnabled;
+    }
+
+    /// @brief marks the start of a simulation step
+    static void beginStep() {
+        if (myAmEnabled) {
+            myLastLap = Clock::now();
+        }
+    }
+
+    /// @brief attributes the time since the last lap to the given phase
+    static void lap(Phase phase) {
+        if (myAmEnabled) {
+            const Clock::time_point now = Clock::now();
+            myNanos[phase] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - myLastLap).count();
+            myLastLap = now;
+        }
+    }
+
+    /// @brief increments the given counter
+    static void count(Counter counter) {
+        myCounts[counter]++;
+    }
+
+    /// @brief finishes the step and writes an interval if the period is over
+    static void endStep(SUMOTime step);
+
+    /// @brief writes the pending (incomplete) interval
+    static void close(SUMOTime step);
+
+    /** @brief returns the accumulated value for the given phase or counter name
+     *
+     * Phases are reported in milliseconds since the start of the simulation.
+     * @return whether the name was known
+     */
+    static bool getValue(const std::string& name, double& value);
+
+    /// @brief returns a summary of all phases and counters for the performance report
+    static std::string printStatistics();
+
+    /// @brief the attribute name of the phase
+    static const char* getName(Phase phase);
+
+    /// @brief the attribute name of the counter
+    static const char* getName(Counter counter);
+
+private:
+    /// @brief writes the interval since the last write
+    static void writeInterval(OutputDevice& dev, SUMOTime end);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    /// @brief whether timing is active
+    static bool myAmEnabled;
+
+    /// @brief the end of the last lap
+    static Clock::time_point myLastLap;
+
+    /// @brief accumulated nanoseconds per phase
+    static long long myNanos[PHASE_NUMBER];
+
+    /// @brief accumulated counts
+    static long long myCounts[COUNTER_NUMBER];
+
+    /// @brief the values at the last written interval
+    static long long myWrittenNanos[PHASE_NUMBER];
+    static long long myWrittenCounts[COUNTER_NUMBER];
+
+    /// @brief the output device (0 if no output is written)
+    static OutputDevice* myOutput;
+
+    /// @brief output interval length
+    static SUMOTime myPeriod;
+
+    /// @brief begin of the current interval
+    static SUMOTime myIntervalBegin;
+
+    /// @brief number of steps in the current interval
+    static int myIntervalSteps;
+
+private:
+    /// @brief invalidated constructor
+    MSProfiler();
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
@@ -79,6 +79,7 @@
 #include "MSLinkCont.h"
 #include "MSLeaderInfo.h"
 #include "MSDriverState.h"
+#include "MSProfiler.h"
 
 //#define DEBUG_PLAN_MOVE
 //#define DEBUG_PLAN_MOVE_LEADERINFO
@@ -1236,6 +1237,8 @@ MSVehicle::addStop(const SUMOVehicleParameter::Stop& stopPar, std::string& error
                 myState.mySpeed = MIN2(myState.mySpeed, vNew + ACCEL2SPEED(getCarFollowModel().getEmergencyDecel()));
                 myState.myPos = MIN2(myState.myPos, stop.pars.endPos);
                 myCachedPosition = Position::INVALID;
+                myLane->occupancyChanged();
+                MSLane::partialOccupancyChanged(this);
             }
         } else {
             errorMsg = errorMsgStart + " for vehicle '" + myParameter->id + "' on lane '" + stopPar.lane + "' is too close to break.";
@@ -2419,6 +2422,7 @@ MSVehicle::processLinkAproaches(double& vSafe, double& vSafeMin, double& vSafeMi
 
         // the vehicle must change the lane on one of the next lanes (XXX: refs to code further below???, Leo)
         if (link != 0 && (*i).mySetRequest) {
+            MSProfiler::count(MSProfiler::COUNTER_LINK_CHECKS);
 
             const LinkState ls = link->getState();
             // vehicles should brake when running onto a yellow light if the distance allows to halt in front
@@ -3458,6 +3462,7 @@ MSVehicle::checkRewindLinkLanes(const double lengthsInFront, DriveItemVector& lf
         // check which links allow continuation and add pass available to the previous item
         for (int i = ((int)lfLinks.size() - 1); i > 0; --i) {
             DriveProcessItem& item = lfLinks[i - 1];
+            MSProfiler::count(MSProfiler::COUNTER_LINK_CHECKS);
             const bool canLeaveJunction = item.myLink->getViaLane() == 0 || lfLinks[i].mySetRequest;
             const bool opened = item.myLink != 0 && canLeaveJunction && (item.myLink->havePriority() ||
                                 (myInfluencer != 0 && !myInfluencer->getRespectJunctionPriority()) ||
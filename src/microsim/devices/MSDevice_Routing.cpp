@@ -32,6 +32,7 @@
 #include <microsim/MSEventControl.h>
 #include <microsim/MSGlobals.h>
 #include <microsim/MSVehicleControl.h>
+#include <microsim/MSProfiler.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/common/WrappingCommand.h>
 #include <utils/common/StaticCommand.h>
@@ -40,6 +41,7 @@
 #include <utils/vehicle/AStarRouter.h>
 #include <utils/vehicle/CHRouter.h>
 #include <utils/vehicle/CHRouterWrapper.h>
+#include <utils/vehicle/CachingRouter.h>
 
 
 // ===========================================================================
@@ -53,10 +55,15 @@ int MSDevice_Routing::myAdaptationSteps;
 int MSDevice_Routing::myAdaptationStepsIndex = 0;
 SUMOTime MSDevice_Routing::myAdaptationInterval = -1;
 SUMOTime MSDevice_Routing::myLastAdaptation = -1;
+long long int MSDevice_Routing::myWeightsEpoch = 0;
+SUMOTime MSDevice_Routing::myCachePeriod = 0;
+SUMOTime MSDevice_Routing::myNextWeightsEpoch = 0;
 bool MSDevice_Routing::myWithTaz;
 std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*> MSDevice_Routing::myCachedRoutes;
 SUMOAbstractRouter<MSEdge, SUMOVehicle>* MSDevice_Routing::myRouter = 0;
 AStarRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >* MSDevice_Routing::myRouterWithProhibited = 0;
+ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >* MSDevice_Routing::myMatrixRouter = 0;
+std::vector<double> MSDevice_Routing::myFrozenEfforts;
 double MSDevice_Routing::myRandomizeWeightsFactor = 0;
 #ifdef HAVE_FOX
 FXWorkerThread::Pool MSDevice_Routing::myThreadPool;
@@ -104,6 +111,12 @@ MSDevice_Routing::insertOptions(OptionsCont& oc) {
     oc.doRegister("device.rerouting.threads", new Option_Integer(0));
     oc.addDescription("device.rerouting.threads", "Routing", "The number of parallel execution threads used for rerouting");
 
+    oc.doRegister("device.rerouting.cache", new Option_Bool(false));
+    oc.addDescription("device.rerouting.cache", "Routing", "Reuse the routes of repeated origin-destination pairs until the edge weights get updated");
+
+    oc.doRegister("device.rerouting.cache.period", new Option_String("60", "TIME"));
+    oc.addDescription("device.rerouting.cache.period", "Routing", "Keep the cached routes for TIME even if the edge weights are updated more often");
+
     oc.doRegister("device.rerouting.output", new Option_FileName());
     oc.addDescription("device.rerouting.output", "Routing", "Save adapting weights to FILE");
 
@@ -112,6 +125,9 @@ MSDevice_Routing::insertOptions(OptionsCont& oc) {
     myAdaptationInterval = -1;
     myAdaptationSteps = -1;
     myLastAdaptation = -1;
+    myWeightsEpoch = 0;
+    myCachePeriod = 0;
+    myNextWeightsEpoch = 0;
 }
 
 
@@ -126,10 +142,17 @@ MSDevice_Routing::checkOptions(OptionsCont& oc) {
         WRITE_ERROR("weights.random-factor cannot be less than 1");
         ok = false;
     }
+    if (oc.getBool("device.rerouting.cache") && oc.getFloat("weights.random-factor") > 1) {
+        WRITE_WARNING("Route caching is disabled because of randomized edge weights.");
+    }
     if (string2time(oc.getString("device.rerouting.adaptation-interval")) < 0) {
         WRITE_ERROR("Negative value for device.rerouting.adaptation-interval!");
         ok = false;
     }
+    if (string2time(oc.getString("device.rerouting.cache.period")) < 0) {
+        WRITE_ERROR("Negative value for device.rerouting.cache.period!");
+        ok = false;
+    }
     if (oc.getFloat("device.rerouting.adaptation-weight") < 0.  ||
             oc.getFloat("device.rerouting.adaptation-weight") > 1.) {
         WRITE_ERROR("The value for device.rerouting.adaptation-weight must be between 0 and 1!");
@@ -157,6 +180,7 @@ MSDevice_Routing::buildVehicleDevices(SUMOVehicle& v, std::vector<MSDevice*>& in
         if (myAdaptationInterval == -1) {
             myAdaptationInterval = string2time(oc.getString("device.rerouting.adaptation-interval"));
             myAdaptationWeight = oc.getFloat("device.rerouting.adaptation-weight");
+            myCachePeriod = string2time(oc.getString("device.rerouting.cache.period"));
             if (myAdaptationWeight < 1. && myAdaptationInterval > 0) {
                 myEdgeWeightSettingCommand = new StaticCommand<MSDevice_Routing>(&MSDevice_Routing::adaptEdgeEfforts);
                 MSNet::getInstance()->getEndOfTimestepEvents()->addEvent(myEdgeWeightSettingCommand);
@@ -286,7 +310,7 @@ MSDevice_Routing::getEffort(const MSEdge* const e, const SUMOVehicle* const v, d
     if (id < (int)myEdgeSpeeds.size()) {
         double effort = MAX2(e->getLength() / MAX2(myEdgeSpeeds[id], NUMERICAL_EPS), e->getMinimumTravelTime(v));
         if (myRandomizeWeightsFactor != 1) {
-            effort *= RandHelper::rand((double)1, myRandomizeWeightsFactor);
+            effort *= RandHelper::rand((double)1, myRandomizeWeightsFactor, getThreadRNG());
         }
         return effort;
     }
@@ -294,6 +318,24 @@ MSDevice_Routing::getEffort(const MSEdge* const e, const SUMOVehicle* const v, d
 }
 
 
+double
+MSDevice_Routing::getFrozenEffort(const MSEdge* const e, const SUMOVehicle* const /* v */, double) {
+    return myFrozenEfforts[e->getNumericalID()];
+}
+
+
+std::mt19937*
+MSDevice_Routing::getThreadRNG() {
+#ifdef HAVE_FOX
+    WorkerThread* const thread = dynamic_cast<WorkerThread*>(FXThread::self());
+    if (thread != 0) {
+        return &thread->getRNG();
+    }
+#endif
+    return 0;
+}
+
+
 double
 MSDevice_Routing::getAssumedSpeed(const MSEdge* edge) {
     return edge->getLength() / getEffort(edge, 0, 0);
@@ -333,6 +375,11 @@ MSDevice_Routing::adaptEdgeEfforts(SUMOTime currentTime) {
         }
     }
     myLastAdaptation = currentTime + DELTA_T; // because we run at the end of the time step
+    if (myLastAdaptation >= myNextWeightsEpoch) {
+        // the cached routes are kept for the cache period and not dropped with every update
+        myWeightsEpoch++;
+        myNextWeightsEpoch = myLastAdaptation + myCachePeriod;
+    }
     if (OptionsCont::getOptions().isSet("device.rerouting.output")) {
         OutputDevice& dev = OutputDevice::getDeviceByOption("device.rerouting.output");
         dev.openTag(SUMO_TAG_INTERVAL);
@@ -387,8 +434,9 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
                     const double speedFactor = myHolder.getChosenSpeedFactor();
                     // we need an exemplary vehicle with speedFactor 1
                     myHolder.setChosenSpeedFactor(1);
+                    // without loaded or set weights this equals MSNet::getTravelTime, with them it keeps the distances lower bounds
                     CHRouterWrapper<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> > router(
-                        MSEdge::getAllEdges(), true, &MSNet::getTravelTime,
+                        MSEdge::getAllEdges(), true, &MSEdge::getMinimumTravelTimeStatic,
                         string2time(oc.getString("begin")), string2time(oc.getString("end")), std::numeric_limits<int>::max(), 1);
                     lookup = new AStar::LMLT(oc.getString("astar.landmark-distances"), MSEdge::getAllEdges(), &router, &myHolder, "", oc.getInt("device.rerouting.threads"));
                     myHolder.setChosenSpeedFactor(speedFactor);
@@ -404,7 +452,7 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
                     // we need an exemplary vehicle with speedFactor 1
                     myHolder.setChosenSpeedFactor(1);
                     CHRouterWrapper<MSEdge, SUMOVehicle, noProhibitions<MSEdge, SUMOVehicle> > router(
-                        MSEdge::getAllEdges(), true, &MSNet::getTravelTime,
+                        MSEdge::getAllEdges(), true, &MSEdge::getMinimumTravelTimeStatic,
                         string2time(oc.getString("begin")), string2time(oc.getString("end")), std::numeric_limits<int>::max(), 1);
                     lookup = new AStar::LMLT(oc.getString("astar.landmark-distances"), MSEdge::getAllEdges(), &router, &myHolder, "", oc.getInt("device.rerouting.threads"));
                     myHolder.setChosenSpeedFactor(speedFactor);
@@ -428,12 +476,18 @@ MSDevice_Routing::reroute(const SUMOTime currentTime, const bool onInit) {
         } else {
             throw ProcessError("Unknown routing algorithm '" + routingAlgorithm + "'!");
         }
+        if (oc.getBool("device.rerouting.cache") && myRandomizeWeightsFactor == 1) {
+            // the efforts do not depend on the time, only on the adaptation step
+            myRouter = new CachingRouter<MSEdge, SUMOVehicle>(myRouter, &MSDevice_Routing::getEffort,
+                    std::vector<SUMOTime>(), &MSDevice_Routing::getWeightsEpoch);
+        }
     }
+    MSProfiler::count(MSProfiler::COUNTER_ROUTER_CALLS);
 #ifdef HAVE_FOX
     if (needThread) {
         const int numThreads = OptionsCont::getOptions().getInt("device.rerouting.threads");
         if (myThreadPool.size() < numThreads) {
-            new WorkerThread(myThreadPool, myRouter);
+            new WorkerThread(myThreadPool, myRouter, 23423 + myThreadPool.size());
         }
         if (myThreadPool.size() < numThreads) {
             myRouter = 0;
@@ -459,6 +513,24 @@ MSDevice_Routing::getRouterTT(const MSEdgeVector& prohibited) {
 }
 
 
+ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >&
+MSDevice_Routing::getMatrixRouter(const SUMOVehicle* const v) {
+    if (myMatrixRouter == 0) {
+        myMatrixRouter = new ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >(
+            MSEdge::getAllEdges(), true, myRandomizeWeightsFactor != 1 ? &MSDevice_Routing::getFrozenEffort : &MSDevice_Routing::getEffort,
+            nullptr, OptionsCont::getOptions().getInt("device.rerouting.threads"));
+    }
+    if (myRandomizeWeightsFactor != 1) {
+        const MSEdgeVector& edges = MSEdge::getAllEdges();
+        myFrozenEfforts.resize(edges.size());
+        for (const MSEdge* const e : edges) {
+            myFrozenEfforts[e->getNumericalID()] = getEffort(e, v, 0);
+        }
+    }
+    return *myMatrixRouter;
+}
+
+
 std::string
 MSDevice_Routing::getParameter(const std::string& key) const {
     if (StringUtils::startsWith(key, "edge:")) {
@@ -490,6 +562,7 @@ MSDevice_Routing::setParameter(const std::string& key, const std::string& value)
             throw InvalidArgument("Edge '" + edgeID + "' is invalid for parameter setting of '" + deviceName() + "'");
         }
         myEdgeSpeeds[edge->getNumericalID()] = edge->getLength() / doubleValue;
+        myWeightsEpoch++;
     } else if (key == "period") {
         const SUMOTime oldPeriod = myPeriod;
         myPeriod = TIME2STEPS(doubleValue);
@@ -510,6 +583,8 @@ void
 MSDevice_Routing::cleanup() {
     delete myRouterWithProhibited;
     myRouterWithProhibited = 0;
+    delete myMatrixRouter;
+    myMatrixRouter = 0;
 #ifdef HAVE_FOX
     if (myThreadPool.size() > 0) {
         // we cannot wait for the static destructor to do the cleanup
@@ -29,9 +29,11 @@
 #include <vector>
 #include <map>
 #include <utils/common/SUMOTime.h>
+#include <utils/common/RandHelper.h>
 #include <utils/common/WrappingCommand.h>
 #include <utils/vehicle/SUMOAbstractRouter.h>
 #include <utils/vehicle/AStarRouter.h>
+#include <utils/vehicle/ManyToManyRouter.h>
 #include <microsim/MSVehicle.h>
 #include "MSDevice.h"
 
@@ -102,6 +104,11 @@ public:
     /// @brief deletes the router instance
     static void cleanup();
 
+    /// @brief Invalidates the route cache after the lane permissions changed
+    static void permissionsChanged() {
+        myWeightsEpoch++;
+    }
+
     /// @brief returns whether any routing actions take place
     static bool isEnabled() {
         return !myWithTaz && myAdaptationInterval >= 0;
@@ -111,6 +118,15 @@ public:
     static SUMOAbstractRouter<MSEdge, SUMOVehicle>& getRouterTT(
         const MSEdgeVector& prohibited = MSEdgeVector());
 
+    /** @brief return the router instance for travel time matrices (initialize on first use)
+     *
+     * The randomized efforts (weights.random-factor) of the given vehicle are
+     *  drawn once per call on the calling thread, so the worker threads of the
+     *  matrix router only read them and the result does not depend on the thread count.
+     * @param[in] v The vehicle to compute the matrix for (may be 0)
+     */
+    static ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >& getMatrixRouter(const SUMOVehicle* const v);
+
 #ifdef HAVE_FOX
     static void waitForAll();
     static void lock() {
@@ -181,6 +197,25 @@ public:
     /// @brief return current travel speed assumption
     static double getAssumedSpeed(const MSEdge* edge);
 
+    /** @brief Returns the effort to pass an edge
+     *
+     * This method is given to the used router in order to obtain the efforts
+     *  to pass an edge from the internal edge weights container.
+     *
+     * The time is not used, here, as the current simulation state is
+     *  used in an aggregated way.
+     *
+     * @param[in] e The edge for which the effort to be passed shall be returned
+     * @param[in] v The vehicle that is rerouted
+     * @param[in] t The time for which the effort shall be returned
+     * @return The effort (time to pass in this case) for an edge
+     * @see DijkstraRouter_ByProxi
+     */
+    static double getEffort(const MSEdge* const e, const SUMOVehicle* const v, double t);
+
+    /// @brief Returns the effort drawn for the current matrix computation (see getMatrixRouter)
+    static double getFrozenEffort(const MSEdge* const e, const SUMOVehicle* const v, double t);
+
     /// @brief try to retrieve the given parameter from this device. Throw exception for unsupported key
     std::string getParameter(const std::string& key) const;
 
@@ -197,17 +232,24 @@ private:
     class WorkerThread : public FXWorkerThread {
     public:
         WorkerThread(FXWorkerThread::Pool& pool,
-                     SUMOAbstractRouter<MSEdge, SUMOVehicle>* router)
-            : FXWorkerThread(pool), myRouter(router) {}
+                     SUMOAbstractRouter<MSEdge, SUMOVehicle>* router, const int seed)
+            : FXWorkerThread(pool), myRouter(router) {
+            RandHelper::initRand(&myRNG, false, seed);
+        }
         SUMOAbstractRouter<MSEdge, SUMOVehicle>& getRouter() const {
             return *myRouter;
         }
+        /// @brief the random number generator for the weight randomization in this thread
+        std::mt19937& getRNG() {
+            return myRNG;
+        }
         virtual ~WorkerThread() {
             stop();
             delete myRouter;
         }
     private:
         SUMOAbstractRouter<MSEdge, SUMOVehicle>* myRouter;
+        std::mt19937 myRNG;
     };
 
     /**
@@ -241,6 +283,9 @@ private:
     /// @brief initialize the edge weights if not done before
     static void initEdgeWeights();
 
+    /// @brief the random number generator of the calling routing thread (0 means the global one)
+    static std::mt19937* getThreadRNG();
+
     /** @brief Performs rerouting before insertion into the network
      *
      * A new route is computed by calling the reroute method. If the routing
@@ -271,23 +316,6 @@ private:
     SUMOTime wrappedRerouteCommandExecute(SUMOTime currentTime);
 
 
-    /** @brief Returns the effort to pass an edge
-     *
-     * This method is given to the used router in order to obtain the efforts
-     *  to pass an edge from the internal edge weights container.
-     *
-     * The time is not used, here, as the current simulation state is
-     *  used in an aggregated way.
-     *
-     * @param[in] e The edge for which the effort to be passed shall be returned
-     * @param[in] v The vehicle that is rerouted
-     * @param[in] t The time for which the effort shall be returned
-     * @return The effort (time to pass in this case) for an edge
-     * @see DijkstraRouter_ByProxi
-     */
-    static double getEffort(const MSEdge* const e, const SUMOVehicle* const v, double t);
-
-
 
     /// @name Network state adaptation
     /// @{
@@ -304,6 +332,11 @@ private:
      * @see StaticCommand
      */
     static SUMOTime adaptEdgeEfforts(SUMOTime currentTime);
+
+    /// @brief Returns the number of edge weight changes which invalidate the route cache
+    static long long int getWeightsEpoch() {
+        return myWeightsEpoch;
+    }
     /// @}
 
 
@@ -338,6 +371,15 @@ private:
     /// @brief Information when the last edge weight adaptation occurred
     static SUMOTime myLastAdaptation;
 
+    /// @brief Counter of the edge weight and permission changes
+    static long long int myWeightsEpoch;
+
+    /// @brief The minimum time between two weight epochs caused by the weight adaptation
+    static SUMOTime myCachePeriod;
+
+    /// @brief The time from which on the next weight adaptation starts a new epoch
+    static SUMOTime myNextWeightsEpoch;
+
     /// @brief The number of steps for averaging edge speeds (ring-buffer)
     static int myAdaptationSteps;
 
@@ -359,6 +401,12 @@ private:
     /// @brief The router to use by rerouter elements
     static AStarRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >* myRouterWithProhibited;
 
+    /// @brief The router for travel time matrices
+    static ManyToManyRouter<MSEdge, SUMOVehicle, prohibited_withPermissions<MSEdge, SUMOVehicle> >* myMatrixRouter;
+
+    /// @brief The randomized efforts of the current matrix computation
+    static std::vector<double> myFrozenEfforts;
+
     /// @brief Whether to disturb edge weights dynamically
     static double myRandomizeWeightsFactor;
 
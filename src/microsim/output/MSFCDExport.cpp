@@ -55,46 +55,54 @@ MSFCDExport::write(OutputDevice& of, SUMOTime timestep, bool elevation) {
     }
     of.openTag("timestep").writeAttr(SUMO_ATTR_TIME, time2string(timestep));
     MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
+    // collect the vehicles first to convert all positions at once
+    std::vector<const SUMOVehicle*> vehicles;
+    PositionVector positions;
     for (MSVehicleControl::constVehIt it = vc.loadedVehBegin(); it != vc.loadedVehEnd(); ++it) {
         const SUMOVehicle* veh = it->second;
-        const MSVehicle* microVeh = dynamic_cast<const MSVehicle*>(veh);
         if ((veh->isOnRoad() || veh->isParking() || veh->isRemoteControlled()) 
                 && veh->getDevice(typeid(MSDevice_FCD)) != nullptr) {
-            Position pos = veh->getPosition();
-            if (useGeo) {
-                of.setPrecision(gPrecisionGeo);
-                GeoConvHelper::getFinal().cartesian2geo(pos);
-            }
-            of.openTag(SUMO_TAG_VEHICLE);
-            of.writeAttr(SUMO_ATTR_ID, veh->getID());
-            of.writeAttr(SUMO_ATTR_X, pos.x());
-            of.writeAttr(SUMO_ATTR_Y, pos.y());
-            if (elevation) {
-                of.writeAttr(SUMO_ATTR_Z, pos.z());
-            }
-            of.writeAttr(SUMO_ATTR_ANGLE, GeomHelper::naviDegree(veh->getAngle()));
-            of.writeAttr(SUMO_ATTR_TYPE, veh->getVehicleType().getID());
-            of.writeAttr(SUMO_ATTR_SPEED, veh->getSpeed());
-            of.writeAttr(SUMO_ATTR_POSITION, veh->getPositionOnLane());
-            if (microVeh != 0) {
-                of.writeAttr(SUMO_ATTR_LANE, microVeh->getLane()->getID());
-            }
-            of.writeAttr(SUMO_ATTR_SLOPE, veh->getSlope());
-            if (microVeh != 0 && signals) {
-                of.writeAttr("signals", toString(microVeh->getSignals()));
-            }
-            of.closeTag();
-            // write persons and containers
-            const MSEdge* edge = microVeh == 0 ? veh->getEdge() : &veh->getLane()->getEdge();
+            vehicles.push_back(veh);
+            positions.push_back(veh->getPosition());
+        }
+    }
+    if (useGeo && !vehicles.empty()) {
+        of.setPrecision(gPrecisionGeo);
+        GeoConvHelper::getFinal().cartesian2geo(positions);
+    }
+    for (int i = 0; i < (int)vehicles.size(); i++) {
+        const SUMOVehicle* veh = vehicles[i];
+        const MSVehicle* microVeh = dynamic_cast<const MSVehicle*>(veh);
+        const Position& pos = positions[i];
+        of.openTag(SUMO_TAG_VEHICLE);
+        of.writeAttr(SUMO_ATTR_ID, veh->getID());
+        of.writeAttr(SUMO_ATTR_X, pos.x());
+        of.writeAttr(SUMO_ATTR_Y, pos.y());
+        if (elevation) {
+            of.writeAttr(SUMO_ATTR_Z, pos.z());
+        }
+        of.writeAttr(SUMO_ATTR_ANGLE, GeomHelper::naviDegree(veh->getAngle()));
+        of.writeAttr(SUMO_ATTR_TYPE, veh->getVehicleType().getID());
+        of.writeAttr(SUMO_ATTR_SPEED, veh->getSpeed());
+        of.writeAttr(SUMO_ATTR_POSITION, veh->getPositionOnLane());
+        if (microVeh != 0) {
+            of.writeAttr(SUMO_ATTR_LANE, microVeh->getLane()->getID());
+        }
+        of.writeAttr(SUMO_ATTR_SLOPE, veh->getSlope());
+        if (microVeh != 0 && signals) {
+            of.writeAttr("signals", toString(microVeh->getSignals()));
+        }
+        of.closeTag();
+        // write persons and containers
+        const MSEdge* edge = microVeh == 0 ? veh->getEdge() : &veh->getLane()->getEdge();
 
-            const std::vector<MSTransportable*>& persons = veh->getPersons();
-            for (std::vector<MSTransportable*>::const_iterator it_p = persons.begin(); it_p != persons.end(); ++it_p) {
-                writeTransportable(of, edge, *it_p, SUMO_TAG_PERSON, useGeo, elevation);
-            }
-            const std::vector<MSTransportable*>& containers = veh->getContainers();
-            for (std::vector<MSTransportable*>::const_iterator it_c = containers.begin(); it_c != containers.end(); ++it_c) {
-                writeTransportable(of, edge, *it_c, SUMO_TAG_CONTAINER, useGeo, elevation);
-            }
+        const std::vector<MSTransportable*>& persons = veh->getPersons();
+        for (std::vector<MSTransportable*>::const_iterator it_p = persons.begin(); it_p != persons.end(); ++it_p) {
+            writeTransportable(of, edge, *it_p, SUMO_TAG_PERSON, useGeo, elevation);
+        }
+        const std::vector<MSTransportable*>& containers = veh->getContainers();
+        for (std::vector<MSTransportable*>::const_iterator it_c = containers.begin(); it_c != containers.end(); ++it_c) {
+            writeTransportable(of, edge, *it_c, SUMO_TAG_CONTAINER, useGeo, elevation);
         }
     }
     if (MSNet::getInstance()->getPersonControl().hasTransportables()) {
@@ -76,6 +76,9 @@ const double MSPModel_Striping::DIST_OVERLAP(-1);
 MSPModel_Striping::WalkingAreaPaths MSPModel_Striping::myWalkingAreaPaths;
 MSPModel_Striping::MinNextLengths MSPModel_Striping::myMinNextLengths;
 MSPModel_Striping::Pedestrians MSPModel_Striping::noPedestrians;
+#ifdef HAVE_FOX
+FXMutex MSPModel_Striping::myMutex;
+#endif
 
 
 // model parameters (static to simplify access from class PState
@@ -105,7 +108,12 @@ const double MSPModel_Striping::MIN_STARTUP_DIST(0.4); // meters
 // ===========================================================================
 
 MSPModel_Striping::MSPModel_Striping(const OptionsCont& oc, MSNet* net) :
-    myNumActivePedestrians(0) {
+    myNumActivePedestrians(0),
+    myUseSnapshot(oc.getInt("pedestrian.striping.threads") > 0)
+#ifdef HAVE_FOX
+    , myThreadPool(oc.getInt("pedestrian.striping.threads") > 1 ? oc.getInt("pedestrian.striping.threads") : 0)
+#endif
+{
     net->getBeginOfTimestepEvents()->addEvent(new MovePedestrians(this), net->getCurrentTimeStep() + DELTA_T);
     initWalkingAreaPaths(net);
     // configurable parameters
@@ -271,6 +279,28 @@ MSPModel_Striping::cleanupHelper() {
 }
 
 
+void
+MSPModel_Striping::sortPedestrians(Pedestrians& pedestrians, int dir) {
+    if (pedestrians.size() < 2) {
+        return;
+    }
+    const by_xpos_sorter sorter(dir);
+    if (sorter(pedestrians.back(), pedestrians.front())) {
+        // most likely sorted for the opposite direction
+        std::reverse(pedestrians.begin(), pedestrians.end());
+    }
+    // the ordering is strict (ties are broken by id) so the result equals that of std::sort
+    for (int i = 1; i < (int)pedestrians.size(); ++i) {
+        PState* const p = pedestrians[i];
+        int j = i;
+        for (; j > 0 && sorter(p, pedestrians[j - 1]); --j) {
+            pedestrians[j] = pedestrians[j - 1];
+        }
+        pedestrians[j] = p;
+    }
+}
+
+
 int
 MSPModel_Striping::numStripes(const MSLane* lane) {
     return (int)floor(lane->getWidth() / stripeWidth);
@@ -632,7 +662,9 @@ MSPModel_Striping::getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const
                 }
             }
         }
-        Pedestrians& pedestrians = getPedestrians(nextLane);
+        // during a parallel pass the other lanes are only visible through the snapshot
+        ActiveLanes::iterator snapshot = mySnapshot.find(nextLane);
+        Pedestrians& pedestrians = !myUseSnapshot ? getPedestrians(nextLane) : (snapshot == mySnapshot.end() ? noPedestrians : snapshot->second);
         if (nextLane->getEdge().isWalkingArea()) {
             transformToCurrentLanePositions(obs, currentDir, nextDir, currentLength, nextLength);
             // complex transformation into the coordinate system of the current lane
@@ -660,7 +692,13 @@ MSPModel_Striping::getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const
             // simple transformation into the coordinate system of the current lane
             // (only need to worry about currentDir and nextDir)
             // XXX consider waitingToEnter on nextLane
-            sort(pedestrians.begin(), pedestrians.end(), by_xpos_sorter(nextDir));
+            if (!myUseSnapshot) {
+                // the snapshot is shared between threads and must not be modified
+                sortPedestrians(pedestrians, nextDir);
+            }
+            // for every stripe keep the pedestrian which comes last in walking direction (closest to the entry)
+            const by_xpos_sorter sorter(nextDir);
+            std::vector<const PState*> closest(stripes, (const PState*)0);
             for (int ii = 0; ii < (int)pedestrians.size(); ++ii) {
                 const PState& p = *pedestrians[ii];
                 if (p.myWaitingToEnter || p.myAmJammed) {
@@ -674,12 +712,14 @@ MSPModel_Striping::getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const
                 }
                 newY += offset * stripeWidth;
                 const int stripe = p.stripe(newY);
-                if (stripe >= 0 && stripe < stripes) {
+                if (stripe >= 0 && stripe < stripes && (closest[stripe] == 0 || sorter(closest[stripe], &p))) {
                     obs[stripe] = pObs;
+                    closest[stripe] = &p;
                 }
                 const int otherStripe = p.otherStripe(newY);
-                if (otherStripe >= 0 && otherStripe < stripes) {
+                if (otherStripe >= 0 && otherStripe < stripes && (closest[otherStripe] == 0 || sorter(closest[otherStripe], &p))) {
                     obs[otherStripe] = pObs;
+                    closest[otherStripe] = &p;
                 }
             }
             if (nextLane->getEdge().isCrossing()) {
@@ -735,76 +775,135 @@ MSPModel_Striping::addCloserObstacle(Obstacles& obs, double x, int stripe, int n
 
 void
 MSPModel_Striping::moveInDirection(SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir) {
+    if (myUseSnapshot) {
+        moveInDirectionParallel(currentTime, changedLane, dir);
+        return;
+    }
     for (ActiveLanes::iterator it_lane = myActiveLanes.begin(); it_lane != myActiveLanes.end(); ++it_lane) {
-        const MSLane* lane = it_lane->first;
-        Pedestrians& pedestrians = it_lane->second;
-        if (pedestrians.size() == 0) {
-            continue;
+        if (it_lane->second.size() > 0) {
+            moveLane(it_lane->first, it_lane->second, currentTime, changedLane, dir, true);
         }
-        //std::cout << SIMTIME << ">>> lane=" << lane->getID() << " numPeds=" << pedestrians.size() << "\n";
-        if (lane->getEdge().isWalkingArea()) {
-            const double lateral_offset = (lane->getWidth() - stripeWidth) * 0.5;
-            const double minY = stripeWidth * - 0.5 + NUMERICAL_EPS;
-            const double maxY = stripeWidth * (numStripes(lane) - 0.5) - NUMERICAL_EPS;
-            const WalkingAreaPath* debugPath = 0;
-            // need to handle each walkingAreaPath seperately and transform
-            // coordinates beforehand
-            std::set<const WalkingAreaPath*, walkingarea_path_sorter> paths;
-            for (Pedestrians::iterator it = pedestrians.begin(); it != pedestrians.end(); ++it) {
-                const PState* p = *it;
-                assert(p->myWalkingAreaPath != 0);
-                if (p->myDir == dir) {
-                    paths.insert(p->myWalkingAreaPath);
-                    if DEBUGCOND(*p) {
-                        debugPath = p->myWalkingAreaPath;
-                        std::cout << SIMTIME << " debugging WalkingAreaPath from=" << debugPath->from->getID() << " to=" << debugPath->to->getID() << "\n";
-                    }
+    }
+}
+
+
+void
+MSPModel_Striping::moveInDirectionParallel(SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir) {
+    for (ActiveLanes::const_iterator it_lane = myActiveLanes.begin(); it_lane != myActiveLanes.end(); ++it_lane) {
+        Pedestrians& copies = mySnapshot[it_lane->first];
+        for (Pedestrians::const_iterator it = it_lane->second.begin(); it != it_lane->second.end(); ++it) {
+            copies.push_back(new PState(**it));
+        }
+    }
+    for (ActiveLanes::iterator it_lane = myActiveLanes.begin(); it_lane != myActiveLanes.end(); ++it_lane) {
+        if (it_lane->second.size() > 0) {
+            // seeds are drawn in lane order to be independent of the thread scheduling
+            const int seed = RandHelper::rand(std::numeric_limits<int>::max());
+#ifdef HAVE_FOX
+            if (myThreadPool.size() > 0) {
+                myThreadPool.add(new MoveLaneTask(*this, it_lane->first, it_lane->second, currentTime, changedLane, dir, seed));
+                continue;
+            }
+#endif
+            std::mt19937 rng(seed);
+            moveLane(it_lane->first, it_lane->second, currentTime, changedLane, dir, false, &rng);
+        }
+    }
+#ifdef HAVE_FOX
+    if (myThreadPool.size() > 0) {
+        myThreadPool.waitAll();
+    }
+#endif
+    for (ActiveLanes::iterator it_lane = mySnapshot.begin(); it_lane != mySnapshot.end(); ++it_lane) {
+        for (Pedestrians::iterator it = it_lane->second.begin(); it != it_lane->second.end(); ++it) {
+            delete *it;
+        }
+        it_lane->second.clear();
+    }
+    for (ActiveLanes::iterator it_lane = myActiveLanes.begin(); it_lane != myActiveLanes.end(); ++it_lane) {
+        if (it_lane->second.size() > 0) {
+            arriveAndAdvance(it_lane->second, currentTime, changedLane, dir);
+        }
+    }
+}
+
+
+void
+MSPModel_Striping::moveLane(const MSLane* lane, Pedestrians& pedestrians, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir,
+                            bool advance, std::mt19937* rng) {
+    //std::cout << SIMTIME << ">>> lane=" << lane->getID() << " numPeds=" << pedestrians.size() << "\n";
+    if (lane->getEdge().isWalkingArea()) {
+        const double lateral_offset = (lane->getWidth() - stripeWidth) * 0.5;
+        const double minY = stripeWidth * - 0.5 + NUMERICAL_EPS;
+        const double maxY = stripeWidth * (numStripes(lane) - 0.5) - NUMERICAL_EPS;
+        // the lateral distance to a path is never smaller than the distance to its bounding box
+        const double maxDist = MAX2(fabs(minY - lateral_offset), fabs(maxY - lateral_offset)) + NUMERICAL_EPS;
+        const WalkingAreaPath* debugPath = 0;
+        // need to handle each walkingAreaPath seperately and transform
+        // coordinates beforehand
+        std::set<const WalkingAreaPath*, walkingarea_path_sorter> paths;
+        for (Pedestrians::iterator it = pedestrians.begin(); it != pedestrians.end(); ++it) {
+            const PState* p = *it;
+            assert(p->myWalkingAreaPath != 0);
+            if (p->myDir == dir) {
+                paths.insert(p->myWalkingAreaPath);
+                if DEBUGCOND(*p) {
+                    debugPath = p->myWalkingAreaPath;
+                    std::cout << SIMTIME << " debugging WalkingAreaPath from=" << debugPath->from->getID() << " to=" << debugPath->to->getID() << "\n";
                 }
             }
-            for (std::set<const WalkingAreaPath*, walkingarea_path_sorter>::iterator it = paths.begin(); it != paths.end(); ++it) {
-                const WalkingAreaPath* path = *it;
-                Pedestrians toDelete;
-                Pedestrians transformedPeds;
-                transformedPeds.reserve(pedestrians.size());
-                for (Pedestrians::iterator it_p = pedestrians.begin(); it_p != pedestrians.end(); ++it_p) {
-                    PState* p = *it_p;
-                    if (p->myWalkingAreaPath == path
-                            // opposite direction is already in the correct coordinate system
-                            || (p->myWalkingAreaPath->from == path->to && p->myWalkingAreaPath->to == path->from)) {
-                        transformedPeds.push_back(p);
-                        if (path == debugPath) std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << p->myRelX << " relY=" << p->myRelY << " (untransformed), vecCoord="
-                                                             << path->shape.transformToVectorCoordinates(p->getPosition(*p->myStage, -1)) << "\n";
+        }
+        for (std::set<const WalkingAreaPath*, walkingarea_path_sorter>::iterator it = paths.begin(); it != paths.end(); ++it) {
+            const WalkingAreaPath* path = *it;
+            Pedestrians toDelete;
+            Pedestrians transformedPeds;
+            transformedPeds.reserve(pedestrians.size());
+            for (Pedestrians::iterator it_p = pedestrians.begin(); it_p != pedestrians.end(); ++it_p) {
+                PState* p = *it_p;
+                if (p->myWalkingAreaPath == path
+                        // opposite direction is already in the correct coordinate system
+                        || (p->myWalkingAreaPath->from == path->to && p->myWalkingAreaPath->to == path->from)) {
+                    transformedPeds.push_back(p);
+                    if (path == debugPath) std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << p->myRelX << " relY=" << p->myRelY << " (untransformed), vecCoord="
+                                                         << path->shape.transformToVectorCoordinates(p->getPosition(*p->myStage, -1)) << "\n";
+                } else {
+                    const Position pos = p->getPosition(*p->myStage, -1);
+                    if (!path->boundary.around(pos, maxDist)) {
+                        continue;
+                    }
+                    const Position relPos = path->shape.transformToVectorCoordinates(pos);
+                    const double newY = relPos.y() + lateral_offset;
+                    if (relPos != Position::INVALID && newY >= minY && newY <= maxY) {
+                        PState* tp = new PState(*p);
+                        tp->myRelX = relPos.x();
+                        tp->myRelY = newY;
+                        // only an obstacle, speed may be orthogonal to dir
+                        tp->myDir = !dir;
+                        tp->mySpeed = 0;
+                        toDelete.push_back(tp);
+                        transformedPeds.push_back(tp);
+                        if (path == debugPath) {
+                            std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << relPos.x() << " relY=" << newY << " (transformed), vecCoord=" << relPos << "\n";
+                        }
                     } else {
-                        const Position relPos = path->shape.transformToVectorCoordinates(p->getPosition(*p->myStage, -1));
-                        const double newY = relPos.y() + lateral_offset;
-                        if (relPos != Position::INVALID && newY >= minY && newY <= maxY) {
-                            PState* tp = new PState(*p);
-                            tp->myRelX = relPos.x();
-                            tp->myRelY = newY;
-                            // only an obstacle, speed may be orthogonal to dir
-                            tp->myDir = !dir;
-                            tp->mySpeed = 0;
-                            toDelete.push_back(tp);
-                            transformedPeds.push_back(tp);
-                            if (path == debugPath) {
-                                std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << relPos.x() << " relY=" << newY << " (transformed), vecCoord=" << relPos << "\n";
-                            }
-                        } else {
-                            if (path == debugPath) {
-                                std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << relPos.x() << " relY=" << newY << " (invalid), vecCoord=" << relPos << "\n";
-                            }
+                        if (path == debugPath) {
+                            std::cout << "  ped=" << p->myPerson->getID() << "  relX=" << relPos.x() << " relY=" << newY << " (invalid), vecCoord=" << relPos << "\n";
                         }
                     }
                 }
-                moveInDirectionOnLane(transformedPeds, lane, currentTime, changedLane, dir);
+            }
+            moveInDirectionOnLane(transformedPeds, lane, currentTime, changedLane, dir, rng);
+            if (advance) {
                 arriveAndAdvance(pedestrians, currentTime, changedLane, dir);
-                // clean up
-                for (Pedestrians::iterator it_p = toDelete.begin(); it_p != toDelete.end(); ++it_p) {
-                    delete *it_p;
-                }
             }
-        } else {
-            moveInDirectionOnLane(pedestrians, lane, currentTime, changedLane, dir);
+            // clean up
+            for (Pedestrians::iterator it_p = toDelete.begin(); it_p != toDelete.end(); ++it_p) {
+                delete *it_p;
+            }
+        }
+    } else {
+        moveInDirectionOnLane(pedestrians, lane, currentTime, changedLane, dir, rng);
+        if (advance) {
             arriveAndAdvance(pedestrians, currentTime, changedLane, dir);
         }
     }
@@ -814,7 +913,7 @@ MSPModel_Striping::moveInDirection(SUMOTime currentTime, std::set<MSPerson*>& ch
 void
 MSPModel_Striping::arriveAndAdvance(Pedestrians& pedestrians, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir) {
     // advance to the next lane / arrive at destination
-    sort(pedestrians.begin(), pedestrians.end(), by_xpos_sorter(dir));
+    sortPedestrians(pedestrians, dir);
     // can't use iterators because we do concurrent modification
     for (int i = 0; i < (int)pedestrians.size(); i++) {
         PState* const p = pedestrians[i];
@@ -838,12 +937,13 @@ MSPModel_Striping::arriveAndAdvance(Pedestrians& pedestrians, SUMOTime currentTi
 
 
 void
-MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane* lane, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir) {
+MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane* lane, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir,
+        std::mt19937* rng) {
     const int stripes = numStripes(lane);
     //std::cout << " laneWidth=" << lane->getWidth() << " stripeWidth=" << stripeWidth << " stripes=" << stripes << "\n";
     Obstacles obs(stripes, Obstacle(dir)); // continously updated
     NextLanesObstacles nextLanesObs; // continously updated
-    sort(pedestrians.begin(), pedestrians.end(), by_xpos_sorter(dir));
+    sortPedestrians(pedestrians, dir);
 
     Obstacles crossingVehs(stripes, Obstacle(dir));
     bool hasCrossingVehObs = false;
@@ -925,6 +1025,9 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
             }
             // consider rerouting over another crossing
             if (p.myWalkingAreaPath != 0) {
+#ifdef HAVE_FOX
+                FXMutexLock locker(myMutex);
+#endif
                 // @todo actually another path would be needed starting at the current position
                 p.myNLI = getNextLane(p, p.myLane, p.myWalkingAreaPath->from);
             }
@@ -953,7 +1056,7 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
         }
 
         // walk, taking into account all obstacles
-        p.walk(currentObs, currentTime);
+        p.walk(currentObs, currentTime, rng);
         gDebugFlag1 = false;
         if (!p.myWaitingToEnter && !p.myAmJammed) {
             Obstacle o(p);
@@ -967,6 +1070,9 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
                             Obstacle cObs(c);
                             // we check only for real collisions, no min gap violations
                             if (p.distanceTo(cObs, false) == DIST_OVERLAP) {
+#ifdef HAVE_FOX
+                                FXMutexLock locker(myMutex);
+#endif
                                 WRITE_WARNING("Collision of person '" + p.myPerson->getID() + "' and person '" + c.myPerson->getID()
                                               + "', lane='" + lane->getID() + "', time=" + time2string(currentTime) + ".");
                             }
@@ -1410,7 +1516,7 @@ MSPModel_Striping::PState::moveToNextLane(SUMOTime currentTime) {
 
 
 void
-MSPModel_Striping::PState::walk(const Obstacles& obs, SUMOTime currentTime) {
+MSPModel_Striping::PState::walk(const Obstacles& obs, SUMOTime currentTime, std::mt19937* rng) {
     myAngle = std::numeric_limits<double>::max(); // set on first access or via remote control
     const int stripes = (int)obs.size();
     const int sMax =  stripes - 1;
@@ -1529,6 +1635,9 @@ MSPModel_Striping::PState::walk(const Obstacles& obs, SUMOTime currentTime) {
         if (myWaitingTime > jamTime || myAmJammed) {
             // squeeze slowly through the crowd ignoring others
             if (!myAmJammed) {
+#ifdef HAVE_FOX
+                FXMutexLock locker(myMutex);
+#endif
                 MSNet::getInstance()->getPersonControl().registerJammed();
                 WRITE_WARNING("Person '" + myPerson->getID()
                               + "' is jammed on edge '" + myStage->getEdge()->getID()
@@ -1541,7 +1650,7 @@ MSPModel_Striping::PState::walk(const Obstacles& obs, SUMOTime currentTime) {
         myAmJammed = false;
     }
     // dawdling
-    const double dawdle = MIN2(xSpeed, RandHelper::rand() * vMax * dawdling);
+    const double dawdle = MIN2(xSpeed, RandHelper::rand(rng) * vMax * dawdling);
     xSpeed -= dawdle;
 
     // XXX ensure that diagonal speed <= vMax
@@ -1810,6 +1919,17 @@ MSPModel_Striping::PState::ignoreRed(const MSLink* link) const {
     }
 }
 
+// ===========================================================================
+// MSPModel_Striping::MoveLaneTask method definitions
+// ===========================================================================
+#ifdef HAVE_FOX
+void
+MSPModel_Striping::MoveLaneTask::run(FXWorkerThread* /*context*/) {
+    myModel.moveLane(myLane, myPedestrians, myTime, myChangedLane, myDir, false, &myRNG);
+}
+#endif
+
+
 // ===========================================================================
 // MSPModel_Striping::MovePedestrians method definitions
 // ===========================================================================
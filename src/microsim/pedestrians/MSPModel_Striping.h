@@ -25,9 +25,14 @@
 
 #include <string>
 #include <limits>
+#include <random>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/Command.h>
+#include <utils/geom/Boundary.h>
 #include <utils/options/OptionsCont.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 #include <microsim/MSLane.h>
 #include "MSPerson.h"
 #include "MSPModel.h"
@@ -226,7 +231,8 @@ protected:
             to(_to),
             lane(_walkingArea),
             shape(_shape),
-            length(_shape.length()) {
+            length(_shape.length()),
+            boundary(_shape.getBoxBoundary()) {
         }
 
         WalkingAreaPath(): from(0), to(0), lane(0) {};
@@ -236,6 +242,7 @@ protected:
         const MSLane* lane; // the walkingArea;
         PositionVector shape; // actually const but needs to be copyable by some stl code
         double length;
+        Boundary boundary; // the bounding box of shape for quickly discarding far away pedestrians
 
     };
 
@@ -326,7 +333,7 @@ protected:
         bool moveToNextLane(SUMOTime currentTime);
 
         /// @brief perform position update
-        void walk(const Obstacles& obs, SUMOTime currentTime);
+        void walk(const Obstacles& obs, SUMOTime currentTime, std::mt19937* rng = 0);
 
         /// @brief returns the impatience
         double getImpatience(SUMOTime now) const;
@@ -367,6 +374,32 @@ protected:
         MovePedestrians& operator=(const MovePedestrians&);
     };
 
+#ifdef HAVE_FOX
+    /**
+     * @class MoveLaneTask
+     * @brief A task which moves the pedestrians of a single lane during a parallel pass
+     */
+    class MoveLaneTask : public FXWorkerThread::Task {
+    public:
+        MoveLaneTask(MSPModel_Striping& model, const MSLane* lane, Pedestrians& pedestrians,
+                     SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir, int seed)
+            : myModel(model), myLane(lane), myPedestrians(pedestrians), myTime(currentTime),
+              myChangedLane(changedLane), myDir(dir), myRNG(seed) {}
+        void run(FXWorkerThread* context);
+    private:
+        MSPModel_Striping& myModel;
+        const MSLane* const myLane;
+        Pedestrians& myPedestrians;
+        const SUMOTime myTime;
+        std::set<MSPerson*>& myChangedLane;
+        const int myDir;
+        std::mt19937 myRNG;
+    private:
+        /// @brief Invalidated assignment operator.
+        MoveLaneTask& operator=(const MoveLaneTask&);
+    };
+#endif
+
     /// @brief sorts the persons by position on the lane. If dir is forward, higher x positions come first.
     class by_xpos_sorter {
     public:
@@ -394,8 +427,23 @@ protected:
     /// @brief move all pedestrians forward and advance to the next lane if applicable
     void moveInDirection(SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir);
 
+    /** @brief move all pedestrians forward using a snapshot of the pedestrian positions
+     *
+     * All lanes are moved independently (and concurrently if threads are available)
+     *  while obstacles on the next lanes are taken from a snapshot of the state before
+     *  the pass. Afterwards the pedestrians advance to their next lanes in lane order.
+     *  Every lane uses its own random number generator which keeps the results
+     *  independent of the number of threads.
+     */
+    void moveInDirectionParallel(SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir);
+
+    /// @brief move pedestrians forward on one lane (optionally advancing them to the next lane)
+    void moveLane(const MSLane* lane, Pedestrians& pedestrians, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir,
+                  bool advance, std::mt19937* rng = 0);
+
     /// @brief move pedestrians forward on one lane
-    void moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane* lane, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir);
+    void moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane* lane, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir,
+                               std::mt19937* rng = 0);
 
     /// @brief handle arrivals and lane advancement
     void arriveAndAdvance(Pedestrians& pedestrians, SUMOTime currentTime, std::set<MSPerson*>& changedLane, int dir);
@@ -440,6 +488,11 @@ private:
     /// @brief retrieves the pedestian vector for the given lane (may be empty)
     Pedestrians& getPedestrians(const MSLane* lane);
 
+    /** @brief sorts the pedestrians by position in the given direction
+     * @note the vectors are kept sorted across steps so insertion sort only needs to fix the few changes in order
+     */
+    static void sortPedestrians(Pedestrians& pedestrians, int dir);
+
     /* @brief compute stripe-offset to transform relY values from a lane with origStripes into a lane wit destStrips
      * @note this is called once for transforming nextLane peds to into the current system as obstacles and another time
      * (in reverse) to transform the pedestrian coordinates into the nextLane-coordinates when changing lanes
@@ -458,6 +511,20 @@ private:
     /// @brief store of all lanes which have pedestrians on them
     ActiveLanes myActiveLanes;
 
+    /// @brief whether pedestrians are moved in snapshot based (parallel) passes
+    const bool myUseSnapshot;
+
+    /// @brief copies of all pedestrians taken before a parallel pass (used as obstacles on the next lanes)
+    ActiveLanes mySnapshot;
+
+#ifdef HAVE_FOX
+    /// @brief the thread pool for moving lanes concurrently
+    FXWorkerThread::Pool myThreadPool;
+
+    /// @brief the mutex for accessing the router, the messages and the person control from concurrent lanes
+    static FXMutex myMutex;
+#endif
+
     /// @brief store for walkinArea elements
     static WalkingAreaPaths myWalkingAreaPaths;
     static MinNextLengths myMinNextLengths;
@@ -1349,18 +1349,29 @@ NBEdgeCont::remapIDs(bool numericaIDs, bool reservedIDs, const std::string& pref
 
 void
 NBEdgeCont::checkOverlap(double threshold, double zThreshold) const {
+    // index the (widened) edge boundaries to avoid comparing all pairs of edges
+    NamedRTree rtree;
+    for (EdgeCont::const_iterator it = myEdges.begin(); it != myEdges.end(); it++) {
+        Boundary b = it->second->getGeometry().getBoxBoundary();
+        b.grow(it->second->getTotalWidth() + POSITION_EPS);
+        const float cmin[2] = {(float) b.xmin(), (float) b.ymin()};
+        const float cmax[2] = {(float) b.xmax(), (float) b.ymax()};
+        rtree.Insert(cmin, cmax, it->second);
+    }
     for (EdgeCont::const_iterator it = myEdges.begin(); it != myEdges.end(); it++) {
         const NBEdge* e1 = it->second;
         Boundary b1 = e1->getGeometry().getBoxBoundary();
         b1.grow(e1->getTotalWidth());
         PositionVector outline1 = e1->getCCWBoundaryLine(*e1->getFromNode());
         outline1.append(e1->getCCWBoundaryLine(*e1->getToNode()));
-        // check is symmetric. only check once per pair
-        for (EdgeCont::const_iterator it2 = it; it2 != myEdges.end(); it2++) {
-            const NBEdge* e2 = it2->second;
-            if (e1 == e2) {
-                continue;
-            }
+        std::set<std::string> cands;
+        Named::StoringVisitor visitor(cands);
+        const float cmin[2] = {(float) b1.xmin(), (float) b1.ymin()};
+        const float cmax[2] = {(float) b1.xmax(), (float) b1.ymax()};
+        rtree.Search(cmin, cmax, visitor);
+        // check is symmetric. only check once per pair (in the order of the ids)
+        for (std::set<std::string>::const_iterator it2 = cands.upper_bound(it->first); it2 != cands.end(); ++it2) {
+            const NBEdge* e2 = myEdges.find(*it2)->second;
             Boundary b2 = e2->getGeometry().getBoxBoundary();
             b2.grow(e2->getTotalWidth());
             if (b1.overlapsWith(b2)) {
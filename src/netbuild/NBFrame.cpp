@@ -91,6 +91,9 @@ NBFrame::fillOptions(bool forNetgen) {
     oc.doRegister("reserved-ids", new Option_FileName());
     oc.addDescription("reserved-ids", "Processing", "Ensures that generated ids do not included any of the typed IDs from FILE (SUMO-GUI selection file format)");
 
+    oc.doRegister("threads", new Option_Integer(0));
+    oc.addDescription("threads", "Processing", "The number of parallel execution threads used for computing junction shapes and logics");
+
     if (!forNetgen) {
         oc.doRegister("dismiss-vclasses", new Option_Bool(false));
         oc.addDescription("dismiss-vclasses", "Processing", "Removes vehicle class restrictions from imported edges");
@@ -498,6 +501,16 @@ NBFrame::checkOptions() {
         WRITE_ERROR("only one of the options 'no-internal-links' or 'walkareas' may be given");
         ok = false;
     }
+    if (oc.getInt("threads") < 0) {
+        WRITE_ERROR("the number of threads must not be negative");
+        ok = false;
+    }
+#ifndef HAVE_FOX
+    if (oc.getInt("threads") > 1) {
+        WRITE_ERROR("Parallel junction computation is only possible when compiled with Fox.");
+        ok = false;
+    }
+#endif
     if (!oc.isDefault("tls.green.time") && !oc.isDefault("tls.cycle.time")) {
         WRITE_ERROR("only one of the options 'tls.green.time' or 'tls.cycle.time' may be given");
         ok = false;
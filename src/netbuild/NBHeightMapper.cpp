@@ -57,7 +57,7 @@ NBHeightMapper NBHeightMapper::Singleton;
 
 
 NBHeightMapper::NBHeightMapper():
-    myRTree(&Triangle::addSelf), myRaster(0) {
+    myRTree(&Triangle::addSelf) {
 }
 
 
@@ -74,39 +74,38 @@ NBHeightMapper::get() {
 
 bool
 NBHeightMapper::ready() const {
-    return myRaster != 0 || myTriangles.size() > 0;
+    return myRasters.size() > 0 || myTriangles.size() > 0;
 }
 
 
 double
 NBHeightMapper::getZ(const Position& geo) const {
+    int rasterHint = 0;
+    return getZ(geo, rasterHint);
+}
+
+
+std::vector<double>
+NBHeightMapper::getZ(const PositionVector& geo) const {
+    std::vector<double> result;
+    result.reserve(geo.size());
+    int rasterHint = 0;
+    for (const Position& pos : geo) {
+        result.push_back(getZ(pos, rasterHint));
+    }
+    return result;
+}
+
+
+double
+NBHeightMapper::getZ(const Position& geo, int& rasterHint) const {
     if (!ready()) {
         WRITE_WARNING("Cannot supply height since no height data was loaded");
         return 0;
     }
-    if (myRaster != 0) {
-        double result = -1e6;
-        if (myBoundary.around(geo)) {
-            const int xSize = int((myBoundary.xmax() - myBoundary.xmin()) / mySizeOfPixel.x() + .5);
-            const double normX = (geo.x() - myBoundary.xmin()) / mySizeOfPixel.x();
-            const double normY = (geo.y() - myBoundary.ymax()) / mySizeOfPixel.y();
-            PositionVector corners;
-            corners.push_back(Position(floor(normX) + 0.5, floor(normY) + 0.5, myRaster[(int)normY * xSize + (int)normX]));
-            if (normX - floor(normX) > 0.5) {
-                corners.push_back(Position(floor(normX) + 1.5, floor(normY) + 0.5, myRaster[(int)normY * xSize + (int)normX + 1]));
-            } else {
-                corners.push_back(Position(floor(normX) - 0.5, floor(normY) + 0.5, myRaster[(int)normY * xSize + (int)normX - 1]));
-            }
-            if (normY - floor(normY) > 0.5) {
-                corners.push_back(Position(floor(normX) + 0.5, floor(normY) + 1.5, myRaster[((int)normY + 1) * xSize + (int)normX]));
-            } else {
-                corners.push_back(Position(floor(normX) + 0.5, floor(normY) - 0.5, myRaster[((int)normY - 1) * xSize + (int)normX]));
-            }
-            result = Triangle(corners).getZ(Position(normX, normY));
-        }
-        if (result > -1e5 && result < 1e5) {
-            return result;
-        }
+    const double rasterZ = getRasterZ(geo, rasterHint);
+    if (rasterZ > -1e5 && rasterZ < 1e5) {
+        return rasterZ;
     }
     // coordinates in degrees hence a small search window
     float minB[2];
@@ -132,6 +131,41 @@ NBHeightMapper::getZ(const Position& geo) const {
 }
 
 
+double
+NBHeightMapper::getRasterZ(const Position& geo, int& rasterHint) const {
+    if (myRasters.empty()) {
+        return -1e6;
+    }
+    if (rasterHint < 0 || rasterHint >= (int)myRasters.size() || !myRasters[rasterHint].boundary.around(geo)) {
+        rasterHint = -1;
+        for (int i = 0; i < (int)myRasters.size(); i++) {
+            if (myRasters[i].boundary.around(geo)) {
+                rasterHint = i;
+                break;
+            }
+        }
+        if (rasterHint < 0) {
+            rasterHint = 0;
+            return -1e6;
+        }
+    }
+    const Raster& raster = myRasters[rasterHint];
+    const double normX = (geo.x() - raster.boundary.xmin()) / raster.sizeOfPixel.x();
+    const double normY = (geo.y() - raster.boundary.ymax()) / raster.sizeOfPixel.y();
+    const int col = MIN2((int)normX, raster.xSize - 1);
+    const int row = MIN2((int)normY, raster.ySize - 1);
+    // interpolate on the plane through the centers of the pixel and of its nearest horizontal and vertical neighbor
+    const double dx = normX - col - 0.5;
+    const double dy = normY - row - 0.5;
+    const int col2 = dx > 0 ? col + 1 : col - 1;
+    const int row2 = dy > 0 ? row + 1 : row - 1;
+    const double z = raster.data[row * raster.xSize + col];
+    const double zx = col2 >= 0 && col2 < raster.xSize ? raster.data[row * raster.xSize + col2] : z;
+    const double zy = row2 >= 0 && row2 < raster.ySize ? raster.data[row2 * raster.xSize + col] : z;
+    return z + (zx - z) * fabs(dx) + (zy - z) * fabs(dy);
+}
+
+
 void
 NBHeightMapper::addTriangle(PositionVector corners) {
     Triangle* triangle = new Triangle(corners);
@@ -281,20 +315,25 @@ NBHeightMapper::loadTiff(const std::string& file) {
     }
     const int xSize = poDataset->GetRasterXSize();
     const int ySize = poDataset->GetRasterYSize();
+    Raster raster;
+    raster.xSize = xSize;
+    raster.ySize = ySize;
     double adfGeoTransform[6];
     if (poDataset->GetGeoTransform(adfGeoTransform) == CE_None) {
         Position topLeft(adfGeoTransform[0], adfGeoTransform[3]);
-        mySizeOfPixel.set(adfGeoTransform[1], adfGeoTransform[5]);
-        const double horizontalSize = xSize * mySizeOfPixel.x();
-        const double verticalSize = ySize * mySizeOfPixel.y();
-        myBoundary.add(topLeft);
-        myBoundary.add(topLeft.x() + horizontalSize, topLeft.y() + verticalSize);
+        raster.sizeOfPixel.set(adfGeoTransform[1], adfGeoTransform[5]);
+        const double horizontalSize = xSize * raster.sizeOfPixel.x();
+        const double verticalSize = ySize * raster.sizeOfPixel.y();
+        raster.boundary.add(topLeft);
+        raster.boundary.add(topLeft.x() + horizontalSize, topLeft.y() + verticalSize);
+        myBoundary.add(raster.boundary);
     } else {
         WRITE_ERROR("Could not parse geo information from " + file + ".");
         return 0;
     }
     const int picSize = xSize * ySize;
-    myRaster = (int16_t*)CPLMalloc(sizeof(int16_t) * picSize);
+    raster.data = (int16_t*)CPLMalloc(sizeof(int16_t) * picSize);
+    myRasters.push_back(raster);
     for (int i = 1; i <= poDataset->GetRasterCount(); i++) {
         GDALRasterBand* poBand = poDataset->GetRasterBand(i);
         if (poBand->GetColorInterpretation() != GCI_GrayIndex) {
@@ -308,7 +347,7 @@ NBHeightMapper::loadTiff(const std::string& file) {
             break;
         }
         assert(xSize == poBand->GetXSize() && ySize == poBand->GetYSize());
-        if (poBand->RasterIO(GF_Read, 0, 0, xSize, ySize, myRaster, xSize, ySize, GDT_Int16, 0, 0) == CE_Failure) {
+        if (poBand->RasterIO(GF_Read, 0, 0, xSize, ySize, raster.data, xSize, ySize, GDT_Int16, 0, 0) == CE_Failure) {
             WRITE_ERROR("Failure in reading " + file + ".");
             clearData();
             break;
@@ -331,11 +370,11 @@ NBHeightMapper::clearData() {
     }
     myTriangles.clear();
 #ifdef HAVE_GDAL
-    if (myRaster != 0) {
-        CPLFree(myRaster);
-        myRaster = 0;
+    for (const Raster& raster : myRasters) {
+        CPLFree(raster.data);
     }
 #endif
+    myRasters.clear();
     myBoundary.reset();
 }
 
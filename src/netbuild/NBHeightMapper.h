@@ -81,6 +81,13 @@ public:
     /// @brief returns height for the given geo coordinate (WGS84)
     double getZ(const Position& geo) const;
 
+    /** @brief returns the heights for all given geo coordinates (WGS84)
+     *
+     * Consecutive positions usually fall into the same raster tile which is
+     *  therefore looked up only once for a run of positions.
+     */
+    std::vector<double> getZ(const PositionVector& geo) const;
+
     class QueryResult;
     /* @brief content class for the rtree. Since we wish to be able to use the
      * rtree for spatial querying we have to jump through some minor hoops:
@@ -133,11 +140,22 @@ private:
     /// @brief The RTree for spatial queries
     TRIANGLE_RTREE_QUAL myRTree;
 
-    /// @brief raster height information in m
-    int16_t* myRaster;
+    /// @brief a height raster loaded from a single GeoTIFF file
+    struct Raster {
+        /// @brief height information in m (row by row)
+        int16_t* data;
+        /// @brief dimensions of one pixel
+        Position sizeOfPixel;
+        /// @brief number of pixels per row
+        int xSize;
+        /// @brief number of rows
+        int ySize;
+        /// @brief the area covered by the raster
+        Boundary boundary;
+    };
 
-    /// @brief dimensions of one pixel in raster data
-    Position mySizeOfPixel;
+    /// @brief the loaded height rasters (tiles)
+    std::vector<Raster> myRasters;
 
     /// @brief convex boundary of all known triangles;
     Boundary myBoundary;
@@ -147,6 +165,19 @@ private:
     NBHeightMapper();
     ~NBHeightMapper();
 
+    /** @brief returns height for the given geo coordinate (WGS84)
+     * @param[in] geo The position to retrieve the height for
+     * @param[in, out] rasterHint The index of the raster to try first, updated to the raster containing the position
+     */
+    double getZ(const Position& geo, int& rasterHint) const;
+
+    /** @brief returns height for the given geo coordinate from the raster data
+     * @param[in] geo The position to retrieve the height for
+     * @param[in, out] rasterHint The index of the raster to try first, updated to the raster containing the position
+     * @return the interpolated height or -1e6 if no raster covers the position
+     */
+    double getRasterZ(const Position& geo, int& rasterHint) const;
+
     /// @brief adds one triangles worth of height data
     void addTriangle(PositionVector corners);
 
@@ -82,6 +82,7 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     if (lefthand) {
         mirrorX();
     }
+    const int numThreads = oc.getInt("threads");
 
     // MODIFYING THE SETS OF NODES AND EDGES
 
@@ -152,7 +153,7 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         NBTurningDirectionsComputer::computeTurnDirections(myNodeCont, false);
         NBNodesEdgesSorter::sortNodesEdges(myNodeCont);
         myEdgeCont.computeLaneShapes();
-        myNodeCont.computeNodeShapes();
+        myNodeCont.computeNodeShapes(-1, numThreads);
         myEdgeCont.computeEdgeShapes();
         if (oc.getBool("roundabouts.guess")) {
             myEdgeCont.guessRoundabouts();
@@ -316,9 +317,9 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     before = SysUtils::getCurrentMillis();
     PROGRESS_BEGIN_MESSAGE("Computing node shapes");
     if (oc.exists("geometry.junction-mismatch-threshold")) {
-        myNodeCont.computeNodeShapes(oc.getFloat("geometry.junction-mismatch-threshold"));
+        myNodeCont.computeNodeShapes(oc.getFloat("geometry.junction-mismatch-threshold"), numThreads);
     } else {
-        myNodeCont.computeNodeShapes();
+        myNodeCont.computeNodeShapes(-1, numThreads);
     }
     PROGRESS_TIME_MESSAGE(before);
     //
@@ -452,7 +453,7 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     //
     before = SysUtils::getCurrentMillis();
     PROGRESS_BEGIN_MESSAGE("Computing node logics");
-    myNodeCont.computeLogics(myEdgeCont, oc);
+    myNodeCont.computeLogics(myEdgeCont, oc, numThreads);
     PROGRESS_TIME_MESSAGE(before);
     //
     before = SysUtils::getCurrentMillis();
@@ -491,7 +492,7 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         before = SysUtils::getCurrentMillis();
         PROGRESS_BEGIN_MESSAGE("stretching junctions to smooth geometries");
         myEdgeCont.computeLaneShapes();
-        myNodeCont.computeNodeShapes();
+        myNodeCont.computeNodeShapes(-1, numThreads);
         myEdgeCont.computeEdgeShapes();
         for (std::map<std::string, NBNode*>::const_iterator i = myNodeCont.begin(); i != myNodeCont.end(); ++i) {
             (*i).second->buildInnerEdges();
@@ -602,15 +603,7 @@ NBNetBuilder::mirrorX() {
 bool
 NBNetBuilder::transformCoordinate(Position& from, bool includeInBoundary, GeoConvHelper* from_srs) {
     Position orig(from);
-    bool ok = true;
-    if (GeoConvHelper::getNumLoaded() > 1 
-            && GeoConvHelper::getLoaded().usingGeoProjection() 
-            && from_srs->usingGeoProjection()
-            && *from_srs != GeoConvHelper::getLoaded()) {
-        from_srs->cartesian2geo(from);
-        ok &= GeoConvHelper::getLoaded().x2cartesian(from, false);
-    }
-    ok &= GeoConvHelper::getProcessing().x2cartesian(from, includeInBoundary);
+    const bool ok = transformPlanar(from, includeInBoundary, from_srs);
     if (ok) {
         const NBHeightMapper& hm = NBHeightMapper::get();
         if (hm.ready()) {
@@ -625,6 +618,21 @@ NBNetBuilder::transformCoordinate(Position& from, bool includeInBoundary, GeoCon
 }
 
 
+bool
+NBNetBuilder::transformPlanar(Position& from, bool includeInBoundary, GeoConvHelper* from_srs) {
+    bool ok = true;
+    if (GeoConvHelper::getNumLoaded() > 1 
+            && GeoConvHelper::getLoaded().usingGeoProjection() 
+            && from_srs->usingGeoProjection()
+            && *from_srs != GeoConvHelper::getLoaded()) {
+        from_srs->cartesian2geo(from);
+        ok &= GeoConvHelper::getLoaded().x2cartesian(from, false);
+    }
+    ok &= GeoConvHelper::getProcessing().x2cartesian(from, includeInBoundary);
+    return ok;
+}
+
+
 bool
 NBNetBuilder::transformCoordinates(PositionVector& from, bool includeInBoundary, GeoConvHelper* from_srs) {
     const double maxLength = OptionsCont::getOptions().getFloat("geometry.max-segment-length");
@@ -653,9 +661,38 @@ NBNetBuilder::transformCoordinates(PositionVector& from, bool includeInBoundary,
         // now perform the transformation again so that height mapping can be
         // performed for the new points
     }
+    return transformPositions(from, includeInBoundary, from_srs);
+}
+
+
+bool
+NBNetBuilder::transformPositions(PositionVector& from, bool includeInBoundary, GeoConvHelper* from_srs) {
+    // the heights of the whole geometry are retrieved at once
+    const NBHeightMapper& hm = NBHeightMapper::get();
+    PositionVector geo;
+    if (hm.ready()) {
+        geo = from;
+        if (from_srs != 0 && from_srs->usingGeoProjection()) {
+            from_srs->cartesian2geo(geo);
+        }
+    }
     bool ok = true;
-    for (int i = 0; i < (int) from.size(); i++) {
-        ok = ok && transformCoordinate(from[i], includeInBoundary, from_srs);
+    if (GeoConvHelper::getNumLoaded() > 1
+            && GeoConvHelper::getLoaded().usingGeoProjection()
+            && from_srs->usingGeoProjection()
+            && *from_srs != GeoConvHelper::getLoaded()) {
+        for (int i = 0; i < (int) from.size() && ok; i++) {
+            ok = transformPlanar(from[i], includeInBoundary, from_srs);
+        }
+    } else {
+        // the common case without reprojection converts the whole geometry at once
+        ok = GeoConvHelper::getProcessing().x2cartesian(from, includeInBoundary);
+    }
+    if (hm.ready() && ok) {
+        const std::vector<double> z = hm.getZ(geo);
+        for (int i = 0; i < (int)z.size(); i++) {
+            from[i].set(from[i].x(), from[i].y(), z[i]);
+        }
     }
     return ok;
 }
@@ -213,11 +213,17 @@ public:
     static bool transformCoordinate(Position& from, bool includeInBoundary = true, GeoConvHelper* from_srs = 0);
     static bool transformCoordinates(PositionVector& from, bool includeInBoundary = true, GeoConvHelper* from_srs = 0);
 
+    /// @brief transforms independent loaded positions at once (see transformCoordinate)
+    static bool transformPositions(PositionVector& from, bool includeInBoundary = true, GeoConvHelper* from_srs = 0);
+
     /// @brief whether netbuilding takes place in the context of NETEDIT
     static bool runningNetedit();
 
 
 protected:
+    /// @brief transforms loaded coordinates without retrieving height data (see transformCoordinate)
+    static bool transformPlanar(Position& from, bool includeInBoundary, GeoConvHelper* from_srs);
+
     /**
      * @class by_id_sorter
      * @brief Sorts nodes by their ids
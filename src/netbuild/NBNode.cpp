@@ -33,6 +33,8 @@
 #include <set>
 #include <cmath>
 #include <iterator>
+#include <functional>
+#include <sstream>
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/StringUtils.h>
 #include <utils/options/OptionsCont.h>
@@ -238,6 +240,8 @@ NBNode::NBNode(const std::string& id, const Position& position,
     myType(type),
     myDistrict(0),
     myHaveCustomPoly(false),
+    myHaveLoadedPoly(false),
+    myLoadedPolyHash(0),
     myRequest(0),
     myRadius(UNSPECIFIED_RADIUS),
     myKeepClear(OptionsCont::getOptions().getBool("default.junctions.keep-clear")),
@@ -254,6 +258,8 @@ NBNode::NBNode(const std::string& id, const Position& position, NBDistrict* dist
     myType(district == 0 ? NODETYPE_UNKNOWN : NODETYPE_DISTRICT),
     myDistrict(district),
     myHaveCustomPoly(false),
+    myHaveLoadedPoly(false),
+    myLoadedPolyHash(0),
     myRequest(0),
     myRadius(UNSPECIFIED_RADIUS),
     myKeepClear(OptionsCont::getOptions().getBool("default.junctions.keep-clear")),
@@ -821,6 +827,12 @@ NBNode::computeNodeShape(double mismatchThreshold) {
     if (myHaveCustomPoly) {
         return;
     }
+    if (myHaveLoadedPoly) {
+        if (computeShapeHash() == myLoadedPolyHash) {
+            return;
+        }
+        myHaveLoadedPoly = false;
+    }
     if (myIncomingEdges.size() == 0 && myOutgoingEdges.size() == 0) {
         // may be an intermediate step during network editing
         myPoly.clear();
@@ -1820,6 +1832,39 @@ NBNode::setCustomShape(const PositionVector& shape) {
 }
 
 
+void
+NBNode::setLoadedShape(const PositionVector& shape) {
+    myPoly = shape;
+    myHaveLoadedPoly = myPoly.size() > 1;
+    myLoadedPolyHash = computeShapeHash();
+}
+
+
+std::size_t
+NBNode::computeShapeHash() const {
+    std::ostringstream oss;
+    oss << std::setprecision(gPrecision) << std::fixed << myPosition.z() << " " << myType << " " << myRadius << "\n";
+    // the network may be moved to the origin and the edges may be resorted in between,
+    //  so the geometries are taken relative to the node position and the edges in id order
+    std::map<std::string, const NBEdge*> sorted;
+    for (const NBEdge* const e : myAllEdges) {
+        sorted[e->getID()] = e;
+    }
+    for (const auto& item : sorted) {
+        const NBEdge* const e = item.second;
+        oss << item.first << " " << (e->getFromNode() == this) << " " << e->getLaneSpreadFunction();
+        for (const Position& p : e->getGeometry()) {
+            oss << " " << p - myPosition;
+        }
+        for (int i = 0; i < e->getNumLanes(); i++) {
+            oss << " " << e->getLaneWidth(i) << " " << e->getEndOffset(i) << " " << e->getPermissions(i);
+        }
+        oss << "\n";
+    }
+    return std::hash<std::string>()(oss.str());
+}
+
+
 NBEdge*
 NBNode::getConnectionTo(NBNode* n) const {
     for (EdgeVector::const_iterator i = myOutgoingEdges.begin(); i != myOutgoingEdges.end(); i++) {
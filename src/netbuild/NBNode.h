@@ -471,6 +471,13 @@ public:
     /// @brief set the junction shape
     void setCustomShape(const PositionVector& shape);
 
+    /** @brief set the junction shape loaded from a network
+     *
+     * The shape is kept by computeNodeShape as long as the edges of the node
+     *  stay as they were when calling this method.
+     */
+    void setLoadedShape(const PositionVector& shape);
+
     /// @brief set the turning radius
     void setRadius(double radius) {
         myRadius = radius;
@@ -738,6 +745,9 @@ private:
     /// @brief remove all traffic light definitions that are part of a joined tls
     void removeJoinedTrafficLights();
 
+    /// @brief computes a fingerprint of the node's properties and edges which determine its shape
+    std::size_t computeShapeHash() const;
+
     /// @brief displace lane shapes to account for change in lane width at this node
     void displaceShapeAtWidthChange(const NBEdge::Connection& con, PositionVector& fromShape, PositionVector& toShape) const;
 
@@ -778,6 +788,12 @@ private:
     /// @brief whether this nodes shape was set by the user
     bool myHaveCustomPoly;
 
+    /// @brief whether this nodes shape was loaded and may be kept
+    bool myHaveLoadedPoly;
+
+    /// @brief the fingerprint of the surrounding edges when the shape was loaded
+    std::size_t myLoadedPolyHash;
+
     /// @brief Node requests
     NBRequest* myRequest;
 
@@ -597,6 +597,16 @@ NBNodeCont::joinJunctions(double maxDist, NBDistrictCont& dc, NBEdgeCont& ec, NB
     NodeClusters cands;
     NodeClusters clusters;
     generateNodeClusters(maxDist, cands);
+    // the edges carrying stops must not be joined, look them up once instead of per cluster
+    std::map<const NBEdge*, std::string> stopEdges;
+    if (OptionsCont::getOptions().isSet("ptstop-output")) {
+        for (auto it = sc.begin(); it != sc.end(); it++) {
+            const NBEdge* const edge = ec.retrieve(it->second->getEdgeId());
+            if (edge != 0) {
+                stopEdges.insert(std::make_pair(edge, it->first));
+            }
+        }
+    }
     for (NodeClusters::iterator i = cands.begin(); i != cands.end(); ++i) {
         std::set<NBNode*> cluster = (*i);
         // remove join exclusions
@@ -632,13 +642,13 @@ NBNodeCont::joinJunctions(double maxDist, NBDistrictCont& dc, NBEdgeCont& ec, NB
             continue;
         }
         std::string reason;
-        bool feasible = feasibleCluster(cluster, ec, sc, reason);
+        bool feasible = feasibleCluster(cluster, stopEdges, reason);
         //if (!feasible) std::cout << "\ntry to reduce cluster " << joinNamedToStringSorting(cluster, ',') << "\n";
         if (!feasible) {
             std::string origCluster = joinNamedToStringSorting(cluster, ',');
             if (reduceToCircle(cluster, 4, cluster)) {
                 pruneClusterFringe(cluster);
-                feasible = feasibleCluster(cluster, ec, sc, reason);
+                feasible = feasibleCluster(cluster, stopEdges, reason);
                 if (feasible) {
                     WRITE_WARNING("Reducing junction cluster " + origCluster + " (" + reason + ")");
                 }
@@ -648,7 +658,7 @@ NBNodeCont::joinJunctions(double maxDist, NBDistrictCont& dc, NBEdgeCont& ec, NB
             std::string origCluster = joinNamedToStringSorting(cluster, ',');
             if (reduceToCircle(cluster, 2, cluster)) {
                 pruneClusterFringe(cluster);
-                feasible = feasibleCluster(cluster, ec, sc, reason);
+                feasible = feasibleCluster(cluster, stopEdges, reason);
                 if (feasible) {
                     WRITE_WARNING("Reducing junction cluster " + origCluster + " (" + reason + ")");
                 }
@@ -771,7 +781,7 @@ NBNodeCont::pruneClusterFringe(std::set<NBNode*>& cluster) const {
 
 
 bool
-NBNodeCont::feasibleCluster(const std::set<NBNode*>& cluster, const NBEdgeCont& ec, const NBPTStopCont& sc, std::string& reason) const {
+NBNodeCont::feasibleCluster(const std::set<NBNode*>& cluster, const std::map<const NBEdge*, std::string>& stopEdges, std::string& reason) const {
     // check for clusters which are to complex and probably won't work very well
     // we count the incoming edges of the final junction
     std::map<std::string, double> finalIncomingAngles;
@@ -830,14 +840,20 @@ NBNodeCont::feasibleCluster(const std::set<NBNode*>& cluster, const NBEdgeCont&
         }
     }
     // check for stop edges within the cluster
-    if (OptionsCont::getOptions().isSet("ptstop-output")) {
-        for (auto it = sc.begin(); it != sc.end(); it++) {
-            NBEdge* edge = ec.retrieve(it->second->getEdgeId());
-            if (edge != 0 && cluster.count(edge->getFromNode()) != 0 && cluster.count(edge->getToNode()) != 0) {
-                reason = "it contains stop '" + it->first + "'";
-                return false;
+    if (!stopEdges.empty()) {
+        std::string stop;
+        for (const NBNode* const n : cluster) {
+            for (const NBEdge* const edge : n->getOutgoingEdges()) {
+                std::map<const NBEdge*, std::string>::const_iterator it = stopEdges.find(edge);
+                if (it != stopEdges.end() && cluster.count(edge->getToNode()) != 0 && (stop == "" || it->second < stop)) {
+                    stop = it->second;
+                }
             }
         }
+        if (stop != "") {
+            reason = "it contains stop '" + stop + "'";
+            return false;
+        }
     }
     // prevent removal of long edges unless there is weak circle or a traffic light
     if (cluster.size() > 2) {
@@ -1129,7 +1145,7 @@ NBNodeCont::shouldBeTLSControlled(const std::set<NBNode*>& c) const {
 void
 NBNodeCont::guessTLs(OptionsCont& oc, NBTrafficLightLogicCont& tlc) {
     // build list of definitely not tls-controlled junctions
-    std::vector<NBNode*> ncontrolled;
+    std::set<NBNode*> ncontrolled;
     if (oc.isSet("tls.unset")) {
         std::vector<std::string> notTLControlledNodes = oc.getStringVector("tls.unset");
         for (std::vector<std::string>::const_iterator i = notTLControlledNodes.begin(); i != notTLControlledNodes.end(); ++i) {
@@ -1142,7 +1158,7 @@ NBNodeCont::guessTLs(OptionsCont& oc, NBTrafficLightLogicCont& tlc) {
                 (*j)->removeNode(n);
             }
             n->removeTrafficLights();
-            ncontrolled.push_back(n);
+            ncontrolled.insert(n);
         }
     }
 
@@ -1152,7 +1168,7 @@ NBNodeCont::guessTLs(OptionsCont& oc, NBTrafficLightLogicCont& tlc) {
     if (oc.exists("tls.taz-nodes") && oc.getBool("tls.taz-nodes")) {
         for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
             NBNode* cur = (*i).second;
-            if (cur->isNearDistrict() && find(ncontrolled.begin(), ncontrolled.end(), cur) == ncontrolled.end()) {
+            if (cur->isNearDistrict() && ncontrolled.count(cur) == 0) {
                 setAsTLControlled(cur, tlc, type);
             }
         }
@@ -1175,7 +1191,7 @@ NBNodeCont::guessTLs(OptionsCont& oc, NBTrafficLightLogicCont& tlc) {
         // check which nodes should be controlled
         for (std::map<std::string, NBNode*>::const_iterator i = myNodes.begin(); i != myNodes.end(); ++i) {
             NBNode* node = i->second;
-            if (find(ncontrolled.begin(), ncontrolled.end(), node) != ncontrolled.end()) {
+            if (ncontrolled.count(node) != 0) {
                 continue;
             }
             const EdgeVector& incoming = node->getIncomingEdges();
@@ -1239,7 +1255,7 @@ NBNodeCont::guessTLs(OptionsCont& oc, NBTrafficLightLogicCont& tlc) {
             // regard only junctions which are not yet controlled and are not
             //  forbidden to be controlled
             for (std::set<NBNode*>::iterator j = c.begin(); j != c.end();) {
-                if ((*j)->isTLControlled() || find(ncontrolled.begin(), ncontrolled.end(), *j) != ncontrolled.end()) {
+                if ((*j)->isTLControlled() || ncontrolled.count(*j) != 0) {
                     c.erase(j++);
                 } else {
                     ++j;
@@ -1278,7 +1294,7 @@ NBNodeCont::guessTLs(OptionsCont& oc, NBTrafficLightLogicCont& tlc) {
             continue;
         }
         // do nothing if in the list of explicit non-controlled junctions
-        if (find(ncontrolled.begin(), ncontrolled.end(), cur) != ncontrolled.end()) {
+        if (ncontrolled.count(cur) != 0) {
             continue;
         }
         std::set<NBNode*> c;
@@ -1365,7 +1381,15 @@ NBNodeCont::computeLanes2Lanes() {
 
 // computes the "wheel" of incoming and outgoing edges for every node
 void
-NBNodeCont::computeLogics(const NBEdgeCont& ec, OptionsCont& oc) {
+NBNodeCont::computeLogics(const NBEdgeCont& ec, OptionsCont& oc, const int numThreads) {
+#ifdef HAVE_FOX
+    if (numThreads > 1) {
+        computeParallel(COMPUTE_LOGIC, &ec, &oc, -1, numThreads);
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
     for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
         (*i).second->computeLogic(ec, oc);
     }
@@ -1400,13 +1424,98 @@ NBNodeCont::getFreeID() {
 
 
 void
-NBNodeCont::computeNodeShapes(double mismatchThreshold) {
+NBNodeCont::computeNodeShapes(double mismatchThreshold, const int numThreads) {
+#ifdef HAVE_FOX
+    if (numThreads > 1) {
+        computeParallel(COMPUTE_SHAPE, 0, 0, mismatchThreshold, numThreads);
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
     for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
         (*i).second->computeNodeShape(mismatchThreshold);
     }
 }
 
 
+#ifdef HAVE_FOX
+void
+NBNodeCont::computeParallel(const NodeComputation computation, const NBEdgeCont* const ec, OptionsCont* const oc,
+                            const double mismatchThreshold, const int numThreads) {
+    // number the nodes in the order of the sequential computation
+    std::vector<NBNode*> nodes;
+    std::map<const NBNode*, int> index;
+    for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
+        index[i->second] = (int)nodes.size();
+        nodes.push_back(i->second);
+    }
+    // a node may only start after all conflicting nodes with a smaller index are done
+    std::vector<std::vector<int> > successors(nodes.size());
+    std::vector<int> numPending(nodes.size(), 0);
+    for (int i = 0; i < (int)nodes.size(); i++) {
+        std::set<int> conflicts;
+        for (const NBEdge* const e : nodes[i]->getEdges()) {
+            const NBNode* const other = e->getFromNode() == nodes[i] ? e->getToNode() : e->getFromNode();
+            std::map<const NBNode*, int>::const_iterator it = index.find(other);
+            if (it != index.end()) {
+                conflicts.insert(it->second);
+            }
+        }
+        for (const NBTrafficLightDefinition* const tl : nodes[i]->getControllingTLS()) {
+            for (const NBNode* const other : tl->getNodes()) {
+                std::map<const NBNode*, int>::const_iterator it = index.find(other);
+                if (it != index.end()) {
+                    conflicts.insert(it->second);
+                }
+            }
+        }
+        for (const int j : conflicts) {
+            if (j > i) {
+                successors[i].push_back(j);
+                numPending[j]++;
+            }
+        }
+    }
+    FXWorkerThread::Pool threadPool(numThreads);
+    for (int i = 0; i < (int)nodes.size(); i++) {
+        if (numPending[i] == 0) {
+            threadPool.add(new NodeTask(computation, nodes[i], i, ec, oc, mismatchThreshold));
+        }
+    }
+    int numDone = 0;
+    while (numDone < (int)nodes.size()) {
+        for (FXWorkerThread::Task* const task : threadPool.getFinished()) {
+            const int i = static_cast<NodeTask*>(task)->getNodeIndex();
+            delete task;
+            numDone++;
+            for (const int j : successors[i]) {
+                if (--numPending[j] == 0) {
+                    threadPool.add(new NodeTask(computation, nodes[j], j, ec, oc, mismatchThreshold));
+                }
+            }
+        }
+    }
+    threadPool.waitAll();
+}
+
+
+void
+NBNodeCont::NodeTask::run(FXWorkerThread* /* context */) {
+    switch (myComputation) {
+        case COMPUTE_SHAPE:
+            myNode->computeNodeShape(myMismatchThreshold);
+            break;
+        case COMPUTE_LOGIC:
+            myNode->computeLogic(*myEdgeCont, *myOptions);
+            break;
+        default:
+            break;
+    }
+}
+#endif
+
+
 void
 NBNodeCont::printBuiltNodesStatistics() const {
     int numUnregulatedJunctions = 0;
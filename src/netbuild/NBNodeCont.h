@@ -36,6 +36,9 @@
 #include "NBEdgeCont.h"
 #include "NBNode.h"
 #include <utils/common/UtilExceptions.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -141,8 +144,12 @@ public:
     /// @brief remove geometry-like fringe nodes from cluster 
     void pruneClusterFringe(std::set<NBNode*>& cluster) const; 
 
-    /// @brief determine wether the cluster is not too complex for joining
-    bool feasibleCluster(const std::set<NBNode*>& cluster, const NBEdgeCont& ec, const NBPTStopCont& sc, std::string& reason) const; 
+    /** @brief determine wether the cluster is not too complex for joining
+     * @param[in] cluster The cluster to check
+     * @param[in] stopEdges The edges carrying public transport stops (mapped to their first stop id)
+     * @param[out] reason The reason for not joining the cluster
+     */
+    bool feasibleCluster(const std::set<NBNode*>& cluster, const std::map<const NBEdge*, std::string>& stopEdges, std::string& reason) const;
 
     /// @brief try to find a joinable subset (recursively)
     bool reduceToCircle(std::set<NBNode*>& cluster, int circleSize, std::set<NBNode*> startNodes, std::vector<NBNode*> cands = std::vector<NBNode*>()) const;
@@ -242,8 +249,12 @@ public:
     /// divides the incoming lanes on outgoing lanes
     void computeLanes2Lanes();
 
-    /// build the list of outgoing edges and lanes
-    void computeLogics(const NBEdgeCont& ec, OptionsCont& oc);
+    /** @brief build the list of outgoing edges and lanes
+     * @param[in] ec The edge container
+     * @param[in] oc The options to use
+     * @param[in] numThreads The number of threads to use (computes sequentially if less than two)
+     */
+    void computeLogics(const NBEdgeCont& ec, OptionsCont& oc, const int numThreads = 0);
 
     /// @brief Returns the number of nodes stored in this container
     int size() const {
@@ -258,8 +269,9 @@ public:
 
     /** @brief Compute the junction shape for this node
      * @param[in] mismatchThreshold The threshold for warning about shapes which are away from myPosition
+     * @param[in] numThreads The number of threads to use (computes sequentially if less than two)
      */
-    void computeNodeShapes(double mismatchThreshold = -1);
+    void computeNodeShapes(double mismatchThreshold = -1, const int numThreads = 0);
 
     /** @brief Prints statistics about built nodes
      *
@@ -331,6 +343,56 @@ private:
     bool shouldBeTLSControlled(const std::set<NBNode*>& c) const;
     /// @}
 
+#ifdef HAVE_FOX
+    /// @brief the node-local computations which may run in parallel
+    enum NodeComputation {
+        COMPUTE_SHAPE,
+        COMPUTE_LOGIC
+    };
+
+    /** @brief Runs the given computation for all nodes using a thread pool
+     *
+     * Two nodes sharing an edge or a traffic light may influence each other's
+     *  results, so they are processed in the order of the sequential loop
+     *  (the order of their ids). All other nodes are independent and run in
+     *  parallel, which gives the same network as the sequential computation.
+     *
+     * @param[in] computation The computation to run
+     * @param[in] ec The edge container (for computing logics)
+     * @param[in] oc The options (for computing logics)
+     * @param[in] mismatchThreshold The threshold for warning about shapes (for computing shapes)
+     * @param[in] numThreads The number of threads to use
+     */
+    void computeParallel(const NodeComputation computation, const NBEdgeCont* const ec, OptionsCont* const oc,
+                         const double mismatchThreshold, const int numThreads);
+
+    /**
+     * @class NodeTask
+     * @brief A task running a node-local computation for a single node
+     */
+    class NodeTask : public FXWorkerThread::Task {
+    public:
+        NodeTask(const NodeComputation computation, NBNode* const node, const int nodeIndex,
+                 const NBEdgeCont* const ec, OptionsCont* const oc, const double mismatchThreshold)
+            : myComputation(computation), myNode(node), myNodeIndex(nodeIndex), myEdgeCont(ec),
+              myOptions(oc), myMismatchThreshold(mismatchThreshold) {}
+        void run(FXWorkerThread* context);
+        int getNodeIndex() const {
+            return myNodeIndex;
+        }
+    private:
+        const NodeComputation myComputation;
+        NBNode* const myNode;
+        const int myNodeIndex;
+        const NBEdgeCont* const myEdgeCont;
+        OptionsCont* const myOptions;
+        const double myMismatchThreshold;
+    private:
+        /// @brief Invalidated assignment operator.
+        NodeTask& operator=(const NodeTask&);
+    };
+#endif
+
 
 private:
     /// @brief The running internal id
@@ -47,6 +47,9 @@
 // ===========================================================================
 int NBRequest::myGoodBuilds = 0;
 int NBRequest::myNotBuild = 0;
+#ifdef HAVE_FOX
+FXMutex NBRequest::myCountLock;
+#endif
 
 
 // ===========================================================================
@@ -72,6 +75,8 @@ NBRequest::NBRequest(const NBEdgeCont& ec,
         myDone.push_back(LinkInfoCont(variations, false));
     }
     // insert loaded prohibits
+    int goodBuilds = 0;
+    int notBuild = 0;
     for (NBConnectionProhibits::const_iterator j = loadedProhibits.begin(); j != loadedProhibits.end(); j++) {
         NBConnection prohibited = (*j).first;
         bool ok1 = prohibited.check(ec);
@@ -106,7 +111,7 @@ NBRequest::NBRequest(const NBEdgeCont& ec,
                     myForbids[idx2][idx1] = true;
                     myDone[idx2][idx1] = true;
                     myDone[idx1][idx2] = true;
-                    myGoodBuilds++;
+                    goodBuilds++;
                 }
             } else {
                 std::string pfID = prohibited.getFrom() != 0 ? prohibited.getFrom()->getID() : "UNKNOWN";
@@ -114,10 +119,18 @@ NBRequest::NBRequest(const NBEdgeCont& ec,
                 std::string bfID = sprohibiting.getFrom() != 0 ? sprohibiting.getFrom()->getID() : "UNKNOWN";
                 std::string btID = sprohibiting.getTo() != 0 ? sprohibiting.getTo()->getID() : "UNKNOWN";
                 WRITE_WARNING("could not prohibit " + pfID + "->" + ptID + " by " + bfID + "->" + btID);
-                myNotBuild++;
+                notBuild++;
             }
         }
     }
+    if (goodBuilds + notBuild > 0) {
+#ifdef HAVE_FOX
+        // requests of different junctions may be built in parallel
+        FXMutexLock locker(myCountLock);
+#endif
+        myGoodBuilds += goodBuilds;
+        myNotBuild += notBuild;
+    }
     // ok, check whether someone has prohibited two links vice versa
     //  (this happens also in some Vissim-networks, when edges are joined)
     for (int s1 = 0; s1 < variations; s1++) {
@@ -30,6 +30,9 @@
 #include <vector>
 #include <map>
 #include <bitset>
+#ifdef HAVE_FOX
+#include <fx.h>
+#endif
 #include "NBConnectionDefs.h"
 #include "NBContHelper.h"
 #include <utils/common/UtilExceptions.h>
@@ -251,6 +254,11 @@ private:
 private:
     static int myGoodBuilds, myNotBuild;
 
+#ifdef HAVE_FOX
+    /// @brief the lock for the prohibition statistics
+    static FXMutex myCountLock;
+#endif
+
     /// @brief Invalidated assignment operator
     NBRequest& operator=(const NBRequest& s) = delete;
 };
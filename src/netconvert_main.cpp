@@ -44,6 +44,9 @@
 #include <utils/xml/XMLSubSys.h>
 #include <utils/iodevices/OutputDevice.h>
 #include <utils/geom/GeoConvHelper.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/MFXMutex.h>
+#endif
 
 
 // ===========================================================================
@@ -91,6 +94,11 @@ checkOptions() {
  * ----------------------------------------------------------------------- */
 int
 main(int argc, char** argv) {
+#ifdef HAVE_FOX
+    // make the output aware of threading
+    MFXMutex lock;
+    MsgHandler::assignLock(&lock);
+#endif
     OptionsCont& oc = OptionsCont::getOptions();
     // give some application descriptions
     oc.setApplicationDescription("Network importer / builder for the microscopic, multi-modal traffic simulation SUMO.");
@@ -50,6 +50,9 @@
 #include <utils/geom/GeoConvHelper.h>
 #include <utils/xml/XMLSubSys.h>
 #include <utils/iodevices/OutputDevice.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/MFXMutex.h>
+#endif
 
 
 // ===========================================================================
@@ -194,6 +197,11 @@ buildNetwork(NBNetBuilder& nb) {
 
 int
 main(int argc, char** argv) {
+#ifdef HAVE_FOX
+    // make the output aware of threading
+    MFXMutex lock;
+    MsgHandler::assignLock(&lock);
+#endif
     OptionsCont& oc = OptionsCont::getOptions();
     // give some application descriptions
     oc.setApplicationDescription("Synthetic network generator for the microscopic, multi-modal traffic simulation SUMO.");
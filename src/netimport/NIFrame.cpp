@@ -151,6 +151,9 @@ NIFrame::fillOptions() {
     oc.doRegister("construction-date", new Option_String());
     oc.addDescription("construction-date", "Processing", "Use YYYY-MM-DD date to determine the readiness of features under construction");
 
+    oc.doRegister("junctions.keep-loaded-shapes", new Option_Bool(false));
+    oc.addDescription("junctions.keep-loaded-shapes", "Processing", "Keeps the junction shapes from the sumo-net-file for junctions whose edges did not change");
+
 
     // register xml options
     oc.doRegister("plain.extend-edge-shape", new Option_Bool(false));
@@ -259,6 +262,9 @@ NIFrame::fillOptions() {
     oc.doRegister("osm.skip-duplicates-check", new Option_Bool(false));
     oc.addDescription("osm.skip-duplicates-check", "Processing", "Skips the check for duplicate nodes and edges");
 
+    oc.doRegister("osm.skip-unreferenced-nodes", new Option_Bool(false));
+    oc.addDescription("osm.skip-unreferenced-nodes", "Processing", "Only stores nodes which are referenced by ways or relations (parses the input once more but needs less memory)");
+
     oc.doRegister("osm.elevation", new Option_Bool(false));
     oc.addDescription("osm.elevation", "Processing", "Imports elevation data");
 
@@ -290,6 +296,8 @@ NIFrame::fillOptions() {
     oc.addDescription("opendrive.ignore-widths", "Processing", "Whether lane widths shall be ignored.");
     oc.doRegister("opendrive.curve-resolution", new Option_Float(2.0));
     oc.addDescription("opendrive.curve-resolution", "Processing", "The geometry resolution in m when importing curved geometries as line segments.");
+    oc.doRegister("opendrive.curve-tolerance", new Option_Float(0));
+    oc.addDescription("opendrive.curve-tolerance", "Processing", "The maximum deviation in m when removing superfluous points from curved geometries (0 keeps all points).");
     oc.doRegister("opendrive.advance-stopline", new Option_Float(12.0));
     oc.addDescription("opendrive.advance-stopline", "Processing", "Allow stop lines to be built beyond the start of the junction if the geometries allow so");
     oc.doRegister("opendrive.min-width", new Option_Float(1.8));
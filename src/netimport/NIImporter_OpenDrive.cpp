@@ -895,65 +895,156 @@ void
 NIImporter_OpenDrive::computeShapes(std::map<std::string, OpenDriveEdge*>& edges) {
     OptionsCont& oc = OptionsCont::getOptions();
     const double res = oc.getFloat("opendrive.curve-resolution");
+    const double tolerance = oc.getFloat("opendrive.curve-tolerance");
+#ifdef HAVE_FOX
+    const int numThreads = oc.getInt("threads");
+    FXWorkerThread::Pool threadPool(numThreads > 1 ? numThreads : 0);
+#endif
+    // sample the geometries, each road is independent of all others
     for (std::map<std::string, OpenDriveEdge*>::iterator i = edges.begin(); i != edges.end(); ++i) {
-        OpenDriveEdge& e = *(*i).second;
-        GeometryType prevType = OPENDRIVE_GT_UNKNOWN;
-        for (std::vector<OpenDriveGeometry>::iterator j = e.geometries.begin(); j != e.geometries.end(); ++j) {
-            OpenDriveGeometry& g = *j;
-            PositionVector geom;
-            switch (g.type) {
-                case OPENDRIVE_GT_UNKNOWN:
-                    break;
-                case OPENDRIVE_GT_LINE:
-                    geom = geomFromLine(e, g);
-                    break;
-                case OPENDRIVE_GT_SPIRAL:
-                    geom = geomFromSpiral(e, g, res);
-                    break;
-                case OPENDRIVE_GT_ARC:
-                    geom = geomFromArc(e, g, res);
-                    break;
-                case OPENDRIVE_GT_POLY3:
-                    geom = geomFromPoly(e, g, res);
-                    break;
-                case OPENDRIVE_GT_PARAMPOLY3:
-                    geom = geomFromParamPoly(e, g, res);
-                    break;
-                default:
-                    break;
-            }
-            if (e.geom.size() > 0 && prevType == OPENDRIVE_GT_LINE) {
-                // remove redundant end point of the previous geometry segment
-                // (the start point of the current segment should have the same value)
-                // this avoids geometry errors due to imprecision
-                if (!e.geom.back().almostSame(geom.front())) {
-                    const int index = (int)(j - e.geometries.begin());
-                    WRITE_WARNING("Mismatched geometry for edge '" + e.id + "' between geometry segments " + toString(index - 1) + " and " + toString(index) + ".");
-                }
-                e.geom.pop_back();
-            }
-            //std::cout << " adding geometry to road=" << e.id << " old=" << e.geom << " new=" << geom << "\n";
-            for (PositionVector::iterator k = geom.begin(); k != geom.end(); ++k) {
-                e.geom.push_back_noDoublePos(*k);
-            }
-            prevType = g.type;
+#ifdef HAVE_FOX
+        if (threadPool.size() > 0) {
+            threadPool.add(new ShapeTask(i->second, true, res, tolerance));
+            continue;
         }
+#endif
+        sampleGeometry(*i->second, res, tolerance);
+    }
+#ifdef HAVE_FOX
+    threadPool.waitAll();
+#endif
+    // the projection updates the shared network boundary, so it stays sequential
+    for (std::map<std::string, OpenDriveEdge*>::iterator i = edges.begin(); i != edges.end(); ++i) {
+        OpenDriveEdge& e = *(*i).second;
         if (oc.exists("geometry.min-dist") && !oc.isDefault("geometry.min-dist")) {
             e.geom.removeDoublePoints(oc.getFloat("geometry.min-dist"), true);
         }
         if (!NBNetBuilder::transformCoordinates(e.geom)) {
             WRITE_ERROR("Unable to project coordinates for edge '" + e.id + "'.");
         }
-        // add z-data
+    }
+    for (std::map<std::string, OpenDriveEdge*>::iterator i = edges.begin(); i != edges.end(); ++i) {
+#ifdef HAVE_FOX
+        if (threadPool.size() > 0) {
+            threadPool.add(new ShapeTask(i->second, false, res, tolerance));
+            continue;
+        }
+#endif
+        applyElevationAndOffset(*i->second);
+    }
+#ifdef HAVE_FOX
+    threadPool.waitAll();
+#endif
+}
+
+
+void
+NIImporter_OpenDrive::sampleGeometry(OpenDriveEdge& e, const double res, const double tolerance) {
+    GeometryType prevType = OPENDRIVE_GT_UNKNOWN;
+    for (std::vector<OpenDriveGeometry>::iterator j = e.geometries.begin(); j != e.geometries.end(); ++j) {
+        OpenDriveGeometry& g = *j;
+        PositionVector geom;
+        switch (g.type) {
+            case OPENDRIVE_GT_UNKNOWN:
+                break;
+            case OPENDRIVE_GT_LINE:
+                geom = geomFromLine(e, g);
+                break;
+            case OPENDRIVE_GT_SPIRAL:
+                geom = geomFromSpiral(e, g, res);
+                break;
+            case OPENDRIVE_GT_ARC:
+                geom = geomFromArc(e, g, res);
+                break;
+            case OPENDRIVE_GT_POLY3:
+                geom = geomFromPoly(e, g, res);
+                break;
+            case OPENDRIVE_GT_PARAMPOLY3:
+                geom = geomFromParamPoly(e, g, res);
+                break;
+            default:
+                break;
+        }
+        if (tolerance > 0 && g.type != OPENDRIVE_GT_LINE) {
+            simplifyGeometry(geom, tolerance);
+        }
+        if (e.geom.size() > 0 && prevType == OPENDRIVE_GT_LINE) {
+            // remove redundant end point of the previous geometry segment
+            // (the start point of the current segment should have the same value)
+            // this avoids geometry errors due to imprecision
+            if (!e.geom.back().almostSame(geom.front())) {
+                const int index = (int)(j - e.geometries.begin());
+                WRITE_WARNING("Mismatched geometry for edge '" + e.id + "' between geometry segments " + toString(index - 1) + " and " + toString(index) + ".");
+            }
+            e.geom.pop_back();
+        }
+        //std::cout << " adding geometry to road=" << e.id << " old=" << e.geom << " new=" << geom << "\n";
+        for (PositionVector::iterator k = geom.begin(); k != geom.end(); ++k) {
+            e.geom.push_back_noDoublePos(*k);
+        }
+        prevType = g.type;
+    }
+}
+
+
+void
+NIImporter_OpenDrive::applyElevationAndOffset(OpenDriveEdge& e) {
+    // add z-data
+    int k = 0;
+    double pos = 0;
+    for (std::vector<OpenDriveElevation>::iterator j = e.elevations.begin(); j != e.elevations.end(); ++j) {
+        const OpenDriveElevation& el = *j;
+        const double sNext = (j + 1) == e.elevations.end() ? std::numeric_limits<double>::max() : (*(j + 1)).s;
+        while (k < (int)e.geom.size() && pos < sNext) {
+            const double z = el.computeAt(pos);
+            //std::cout << " edge=" << e.id << " k=" << k << " sNext=" << sNext << " pos=" << pos << " z=" << z << " ds=" << ds << " el.s=" << el.s << "el.a=" << el.a << " el.b=" << el.b << " el.c=" << el.c << " el.d=" << el.d <<  "\n";
+            e.geom[k].add(0, 0, z);
+            k++;
+            if (k < (int)e.geom.size()) {
+                // XXX pos understimates the actual position since the
+                // actual geometry between k-1 and k could be curved
+                pos += e.geom[k - 1].distanceTo2D(e.geom[k]);
+            }
+        }
+    }
+    // add laneoffset
+    if (e.offsets.size() > 0) {
+        // make sure there are intermediate points for each offset-section
+        for (std::vector<OpenDriveLaneOffset>::iterator j = e.offsets.begin(); j != e.offsets.end(); ++j) {
+            const OpenDriveLaneOffset& el = *j;
+            // check wether we need to insert a new point at dist
+            Position pS = e.geom.positionAtOffset2D(el.s);
+            int iS = e.geom.indexOfClosest(pS);
+            // prevent close spacing to reduce impact of rounding errors in z-axis
+            if (pS.distanceTo2D(e.geom[iS]) > POSITION_EPS) {
+                e.geom.insertAtClosest(pS);
+                //std::cout << " edge=" << e.id << " inserting pos=" << pS << " s=" << el.s << " iS=" << iS << " dist=" << pS.distanceTo2D(e.geom[iS]) << "\n";
+            }
+        }
+        // XXX add further points for sections with non-constant offset
+        // shift each point orthogonally by the specified offset
         int k = 0;
         double pos = 0;
-        for (std::vector<OpenDriveElevation>::iterator j = e.elevations.begin(); j != e.elevations.end(); ++j) {
-            const OpenDriveElevation& el = *j;
-            const double sNext = (j + 1) == e.elevations.end() ? std::numeric_limits<double>::max() : (*(j + 1)).s;
+        PositionVector geom2;
+        for (std::vector<OpenDriveLaneOffset>::iterator j = e.offsets.begin(); j != e.offsets.end(); ++j) {
+            const OpenDriveLaneOffset& el = *j;
+            const double sNext = (j + 1) == e.offsets.end() ? std::numeric_limits<double>::max() : (*(j + 1)).s;
             while (k < (int)e.geom.size() && pos < sNext) {
-                const double z = el.computeAt(pos);
-                //std::cout << " edge=" << e.id << " k=" << k << " sNext=" << sNext << " pos=" << pos << " z=" << z << " ds=" << ds << " el.s=" << el.s << "el.a=" << el.a << " el.b=" << el.b << " el.c=" << el.c << " el.d=" << el.d <<  "\n";
-                e.geom[k].add(0, 0, z);
+                const double offset = el.computeAt(pos);
+                //std::cout << " edge=" << e.id << " k=" << k << " sNext=" << sNext << " pos=" << pos << " offset=" << offset << " ds=" << ds << " el.s=" << el.s << "el.a=" << el.a << " el.b=" << el.b << " el.c=" << el.c << " el.d=" << el.d <<  "\n";
+                if (fabs(offset) > POSITION_EPS) {
+                    try {
+                        PositionVector tmp = e.geom;
+                        // XXX shifting the whole geometry is inefficient.  could also use positionAtOffset(lateralOffset=...)
+                        tmp.move2side(-offset);
+                        //std::cout << " edge=" << e.id << " k=" << k << " offset=" << offset << " geom[k]=" << e.geom[k] << " tmp[k]=" << tmp[k] << " gSize=" << e.geom.size() << " tSize=" << tmp.size() <<  " geom=" << e.geom << " tmp=" << tmp << "\n";
+                        geom2.push_back(tmp[k]);
+                    } catch (InvalidArgument&) {
+                        geom2.push_back(e.geom[k]);
+                    }
+                } else {
+                    geom2.push_back(e.geom[k]);
+                }
                 k++;
                 if (k < (int)e.geom.size()) {
                     // XXX pos understimates the actual position since the
@@ -962,58 +1053,67 @@ NIImporter_OpenDrive::computeShapes(std::map<std::string, OpenDriveEdge*>& edges
                 }
             }
         }
-        // add laneoffset
-        if (e.offsets.size() > 0) {
-            // make sure there are intermediate points for each offset-section
-            for (std::vector<OpenDriveLaneOffset>::iterator j = e.offsets.begin(); j != e.offsets.end(); ++j) {
-                const OpenDriveLaneOffset& el = *j;
-                // check wether we need to insert a new point at dist
-                Position pS = e.geom.positionAtOffset2D(el.s);
-                int iS = e.geom.indexOfClosest(pS);
-                // prevent close spacing to reduce impact of rounding errors in z-axis
-                if (pS.distanceTo2D(e.geom[iS]) > POSITION_EPS) {
-                    e.geom.insertAtClosest(pS);
-                    //std::cout << " edge=" << e.id << " inserting pos=" << pS << " s=" << el.s << " iS=" << iS << " dist=" << pS.distanceTo2D(e.geom[iS]) << "\n";
-                }
-            }
-            // XXX add further points for sections with non-constant offset
-            // shift each point orthogonally by the specified offset
-            int k = 0;
-            double pos = 0;
-            PositionVector geom2;
-            for (std::vector<OpenDriveLaneOffset>::iterator j = e.offsets.begin(); j != e.offsets.end(); ++j) {
-                const OpenDriveLaneOffset& el = *j;
-                const double sNext = (j + 1) == e.offsets.end() ? std::numeric_limits<double>::max() : (*(j + 1)).s;
-                while (k < (int)e.geom.size() && pos < sNext) {
-                    const double offset = el.computeAt(pos);
-                    //std::cout << " edge=" << e.id << " k=" << k << " sNext=" << sNext << " pos=" << pos << " offset=" << offset << " ds=" << ds << " el.s=" << el.s << "el.a=" << el.a << " el.b=" << el.b << " el.c=" << el.c << " el.d=" << el.d <<  "\n";
-                    if (fabs(offset) > POSITION_EPS) {
-                        try {
-                            PositionVector tmp = e.geom;
-                            // XXX shifting the whole geometry is inefficient.  could also use positionAtOffset(lateralOffset=...)
-                            tmp.move2side(-offset);
-                            //std::cout << " edge=" << e.id << " k=" << k << " offset=" << offset << " geom[k]=" << e.geom[k] << " tmp[k]=" << tmp[k] << " gSize=" << e.geom.size() << " tSize=" << tmp.size() <<  " geom=" << e.geom << " tmp=" << tmp << "\n";
-                            geom2.push_back(tmp[k]);
-                        } catch (InvalidArgument&) {
-                            geom2.push_back(e.geom[k]);
-                        }
-                    } else {
-                        geom2.push_back(e.geom[k]);
-                    }
-                    k++;
-                    if (k < (int)e.geom.size()) {
-                        // XXX pos understimates the actual position since the
-                        // actual geometry between k-1 and k could be curved
-                        pos += e.geom[k - 1].distanceTo2D(e.geom[k]);
-                    }
-                }
+        assert(e.geom.size() == geom2.size());
+        e.geom = geom2;
+    }
+}
+
+
+void
+NIImporter_OpenDrive::simplifyGeometry(PositionVector& geom, const double tolerance) {
+    if (geom.size() < 3) {
+        return;
+    }
+    // Douglas-Peucker: keep the point farthest from the chord if it deviates more than the tolerance and recurse
+    std::vector<bool> keep(geom.size(), false);
+    keep.front() = true;
+    keep.back() = true;
+    std::vector<std::pair<int, int> > ranges(1, std::make_pair(0, (int)geom.size() - 1));
+    while (!ranges.empty()) {
+        const int first = ranges.back().first;
+        const int last = ranges.back().second;
+        ranges.pop_back();
+        const Position& start = geom[first];
+        const double dx = geom[last].x() - start.x();
+        const double dy = geom[last].y() - start.y();
+        const double length2 = dx * dx + dy * dy;
+        double maxDist = tolerance;
+        int maxIndex = -1;
+        for (int i = first + 1; i < last; i++) {
+            const Position& p = geom[i];
+            const double t = length2 > 0 ? MAX2(0., MIN2(1., ((p.x() - start.x()) * dx + (p.y() - start.y()) * dy) / length2)) : 0.;
+            const double dist = p.distanceTo2D(Position(start.x() + t * dx, start.y() + t * dy));
+            if (dist > maxDist) {
+                maxDist = dist;
+                maxIndex = i;
             }
-            assert(e.geom.size() == geom2.size());
-            e.geom = geom2;
         }
-        //std::cout << " loaded geometry " << e.id << "=" << e.geom << "\n";
+        if (maxIndex >= 0) {
+            keep[maxIndex] = true;
+            ranges.push_back(std::make_pair(first, maxIndex));
+            ranges.push_back(std::make_pair(maxIndex, last));
+        }
+    }
+    PositionVector result;
+    for (int i = 0; i < (int)geom.size(); i++) {
+        if (keep[i]) {
+            result.push_back(geom[i]);
+        }
+    }
+    geom = result;
+}
+
+
+#ifdef HAVE_FOX
+void
+NIImporter_OpenDrive::ShapeTask::run(FXWorkerThread* /* context */) {
+    if (mySample) {
+        sampleGeometry(*myEdge, myResolution, myTolerance);
+    } else {
+        applyElevationAndOffset(*myEdge);
     }
 }
+#endif
 
 
 void
@@ -29,6 +29,9 @@
 #include <map>
 #include <utils/xml/GenericSAXHandler.h>
 #include <utils/geom/PositionVector.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -568,6 +571,40 @@ protected:
      */
     static void computeShapes(std::map<std::string, OpenDriveEdge*>& edges);
 
+    /** @brief Samples the geometry records of the given edge into its (unprojected) shape
+     * @param[in, changed] e The edge to compute the shape for
+     * @param[in] res The sampling distance for curved geometries
+     * @param[in] tolerance The allowed deviation when removing sampled points (0 keeps all points)
+     */
+    static void sampleGeometry(OpenDriveEdge& e, const double res, const double tolerance);
+
+    /// @brief applies the elevation profile and the lane offset to the projected shape of the given edge
+    static void applyElevationAndOffset(OpenDriveEdge& e);
+
+    /// @brief removes all points which deviate less than tolerance from the remaining shape
+    static void simplifyGeometry(PositionVector& geom, const double tolerance);
+
+#ifdef HAVE_FOX
+    /**
+     * @class ShapeTask
+     * @brief A task computing the shape of a single edge (either sampling or applying elevation and offset)
+     */
+    class ShapeTask : public FXWorkerThread::Task {
+    public:
+        ShapeTask(OpenDriveEdge* const edge, const bool sample, const double resolution, const double tolerance)
+            : myEdge(edge), mySample(sample), myResolution(resolution), myTolerance(tolerance) {}
+        void run(FXWorkerThread* context);
+    private:
+        OpenDriveEdge* const myEdge;
+        const bool mySample;
+        const double myResolution;
+        const double myTolerance;
+    private:
+        /// @brief Invalidated assignment operator.
+        ShapeTask& operator=(const ShapeTask&);
+    };
+#endif
+
     /** @brief Rechecks lane sections of the given edges
      *
      *
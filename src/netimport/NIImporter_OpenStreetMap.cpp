@@ -129,16 +129,33 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
         return;
     }
     /* Parse file(s)
-     * Each file is parsed twice: first for nodes, second for edges. */
+     * Each file is parsed twice: first for nodes, second for edges
+     *  (and once more beforehand if only the referenced nodes shall be stored). */
     std::vector<std::string> files = oc.getStringVector("osm-files");
-    // load nodes, first
-    NodesHandler nodesHandler(myOSMNodes, myUniqueNodes, oc);
     for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
-        // nodes
         if (!FileHelpers::isReadable(*file)) {
             WRITE_ERROR("Could not open osm-file '" + *file + "'.");
             return;
         }
+    }
+    // collect the referenced nodes if only those shall be stored
+    const bool referencedOnly = oc.getBool("osm.skip-unreferenced-nodes");
+    if (referencedOnly) {
+        ReferencedNodesHandler referencedHandler(myReferencedNodes);
+        for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
+            referencedHandler.setFileName(*file);
+            PROGRESS_BEGIN_MESSAGE("Collecting referenced nodes from osm-file '" + *file + "'");
+            if (!XMLSubSys::runParser(referencedHandler, *file)) {
+                return;
+            }
+            PROGRESS_DONE_MESSAGE();
+        }
+        referencedHandler.compact();
+    }
+    // load nodes, first
+    NodesHandler nodesHandler(myOSMNodes, myUniqueNodes, oc, referencedOnly ? &myReferencedNodes : 0);
+    for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
+        // nodes
         nodesHandler.setFileName(*file);
         PROGRESS_BEGIN_MESSAGE("Parsing nodes from osm-file '" + *file + "'");
         if (!XMLSubSys::runParser(nodesHandler, *file)) {
@@ -146,6 +163,8 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
         }
         PROGRESS_DONE_MESSAGE();
     }
+    // the referenced ids are not needed any longer
+    std::vector<long long int>().swap(myReferencedNodes);
     // load edges, then
     EdgesHandler edgesHandler(myOSMNodes, myEdges, myPlatformShapes);
     for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
@@ -208,6 +227,7 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
      * one edge are instantiated. Other nodes are considered as geometry nodes. */
     NBNodeCont& nc = nb.getNodeCont();
     NBTrafficLightLogicCont& tlsc = nb.getTLLogicCont();
+    projectJunctionNodes(nodeUsage);
     for (auto& myEdge : myEdges) {
         Edge* e = myEdge.second;
         assert(e->myCurrentIsRoad);
@@ -238,6 +258,7 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
         }
         insertEdge(e, running, currentFrom, last, passed, nb);
     }
+    myProjectedNodes.clear();
 
     const double layerElevation = oc.getFloat("osm.layer-elevation");
     if (layerElevation > 0) {
@@ -262,13 +283,45 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
     }
 }
 
+void
+NIImporter_OpenStreetMap::projectJunctionNodes(std::map<long long int, int>& nodeUsage) {
+    std::vector<long long int> ids;
+    PositionVector positions;
+    for (std::map<long long int, Edge*>::const_iterator i = myEdges.begin(); i != myEdges.end(); ++i) {
+        const std::vector<long long int>& nodes = i->second->myCurrentNodes;
+        if (nodes.size() < 2) {
+            continue;
+        }
+        for (std::vector<long long int>::const_iterator j = nodes.begin(); j != nodes.end(); ++j) {
+            if ((j == nodes.begin() || j == nodes.end() - 1 || nodeUsage[*j] > 1)
+                    && myProjectedNodes.insert(std::make_pair(*j, Position::INVALID)).second) {
+                const NIOSMNode* n = myOSMNodes.find(*j)->second;
+                ids.push_back(*j);
+                positions.push_back(Position(n->lon, n->lat, n->ele));
+            }
+        }
+    }
+    // positions which cannot be projected are reported node-wise by insertNodeChecking
+    if (NBNetBuilder::transformPositions(positions, true)) {
+        for (int i = 0; i < (int)ids.size(); i++) {
+            myProjectedNodes[ids[i]] = positions[i];
+        }
+    } else {
+        myProjectedNodes.clear();
+    }
+}
+
+
 NBNode*
 NIImporter_OpenStreetMap::insertNodeChecking(long long int id, NBNodeCont& nc, NBTrafficLightLogicCont& tlsc) {
     NBNode* node = nc.retrieve(toString(id));
     if (node == 0) {
         NIOSMNode* n = myOSMNodes.find(id)->second;
         Position pos(n->lon, n->lat, n->ele);
-        if (!NBNetBuilder::transformCoordinate(pos, true)) {
+        std::map<long long int, Position>::const_iterator projected = myProjectedNodes.find(id);
+        if (projected != myProjectedNodes.end()) {
+            pos = projected->second;
+        } else if (!NBNetBuilder::transformCoordinate(pos, true)) {
             WRITE_ERROR("Unable to project coordinates for junction '" + toString(id) + "'.");
             return 0;
         }
@@ -661,7 +714,8 @@ NIImporter_OpenStreetMap::insertEdge(Edge* e, int index, NBNode* from, NBNode* t
 // ---------------------------------------------------------------------------
 NIImporter_OpenStreetMap::NodesHandler::NodesHandler(std::map<long long int, NIOSMNode*>& toFill,
         std::set<NIOSMNode*, CompareNodes>& uniqueNodes,
-        const OptionsCont& oc)
+        const OptionsCont& oc,
+        const std::vector<long long int>* referenced)
 
     :
     SUMOSAXHandler("osm - file"),
@@ -671,7 +725,8 @@ NIImporter_OpenStreetMap::NodesHandler::NodesHandler(std::map<long long int, NIO
     myHierarchyLevel(0),
     myUniqueNodes(uniqueNodes),
     myImportElevation(oc.getBool("osm.elevation")),
-    myOptionsCont(oc) {
+    myOptionsCont(oc),
+    myReferenced(referenced) {
 }
 
 NIImporter_OpenStreetMap::NodesHandler::~NodesHandler() = default;
@@ -695,6 +750,9 @@ NIImporter_OpenStreetMap::NodesHandler::myStartElement(int element, const SUMOSA
             return;
         }
         myLastNodeID = -1;
+        if (myReferenced != 0 && !std::binary_search(myReferenced->begin(), myReferenced->end(), id)) {
+            return;
+        }
         if (myToFill.find(id) == myToFill.end()) {
             myLastNodeID = id;
             // assume we are loading multiple files...
@@ -797,6 +855,44 @@ NIImporter_OpenStreetMap::NodesHandler::myEndElement(int element) {
     --myHierarchyLevel;
 }
 
+// ---------------------------------------------------------------------------
+// definitions of NIImporter_OpenStreetMap::ReferencedNodesHandler-methods
+// ---------------------------------------------------------------------------
+NIImporter_OpenStreetMap::ReferencedNodesHandler::ReferencedNodesHandler(std::vector<long long int>& toFill)
+    : SUMOSAXHandler("osm - file"), myToFill(toFill), myCompactSize(0) {
+}
+
+NIImporter_OpenStreetMap::ReferencedNodesHandler::~ReferencedNodesHandler() = default;
+
+void
+NIImporter_OpenStreetMap::ReferencedNodesHandler::myStartElement(int element, const SUMOSAXAttributes& attrs) {
+    bool ok = true;
+    if (element == SUMO_TAG_ND) {
+        const long long int ref = attrs.get<long long int>(SUMO_ATTR_REF, 0, ok);
+        if (ok) {
+            myToFill.push_back(ref);
+        }
+    } else if (element == SUMO_TAG_MEMBER) {
+        if (attrs.getOpt<std::string>(SUMO_ATTR_TYPE, 0, ok, "") == "node") {
+            const long long int ref = attrs.get<long long int>(SUMO_ATTR_REF, 0, ok);
+            if (ok) {
+                myToFill.push_back(ref);
+            }
+        }
+    }
+    // consecutive ways share many nodes, keep the memory bounded by the number of distinct ids
+    if ((int)myToFill.size() > 2 * myCompactSize + 1000000) {
+        compact();
+    }
+}
+
+void
+NIImporter_OpenStreetMap::ReferencedNodesHandler::compact() {
+    std::sort(myToFill.begin(), myToFill.end());
+    myToFill.erase(std::unique(myToFill.begin(), myToFill.end()), myToFill.end());
+    myCompactSize = (int)myToFill.size();
+}
+
 // ---------------------------------------------------------------------------
 // definitions of NIImporter_OpenStreetMap::EdgesHandler-methods
 // ---------------------------------------------------------------------------
@@ -29,9 +29,11 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <utils/xml/SUMOSAXHandler.h>
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/Parameterised.h>
+#include <utils/geom/Position.h>
 #include <netbuild/NBPTPlatform.h>
 
 
@@ -221,12 +223,24 @@ private:
 
     /** @brief the map from OSM node ids to actual nodes
      * @note: NIOSMNodes may appear multiple times due to substition
+     * @note: Each stored node costs about 224 bytes on 64bit platforms (the NIOSMNode
+     *  itself, one node in this map and one in myUniqueNodes). The option
+     *  osm.skip-unreferenced-nodes only avoids storing the nodes which no way or
+     *  relation references. The nodes are not kept in a flat (id, lon, lat, flags)
+     *  array because the NIOSMNode pointers are shared by the edge and relation
+     *  handlers and by the NBNode creation.
      */
     std::map<long long int, NIOSMNode*> myOSMNodes;
 
+    /// @brief the sorted ids of the nodes referenced by ways and relations (if only those shall be loaded)
+    std::vector<long long int> myReferencedNodes;
+
     /// @brief the set of unique nodes used in NodesHandler, used when freeing memory
     std::set<NIOSMNode*, CompareNodes> myUniqueNodes;
 
+    /// @brief the projected positions of the junction nodes (only valid while building the edges)
+    std::map<long long int, Position> myProjectedNodes;
+
 
     /** @brief the map from OSM way ids to edge objects */
     std::map<long long int, Edge*> myEdges;
@@ -256,6 +270,15 @@ private:
      */
     NBNode* insertNodeChecking(long long int id, NBNodeCont& nc, NBTrafficLightLogicCont& tlsc);
 
+    /** @brief Projects the positions of all nodes which will become junctions at once
+     *
+     * The junction nodes are the first and last nodes of the ways and the
+     *  nodes used more than once. If all positions can be projected, they are
+     *  stored in myProjectedNodes and used by insertNodeChecking.
+     * @param[in] nodeUsage The number of usages of the nodes
+     */
+    void projectJunctionNodes(std::map<long long int, int>& nodeUsage);
+
 
     /** @brief Builds an NBEdge
      *
@@ -294,10 +317,12 @@ protected:
          * @param[in, out] toFill The nodes container to fill
          * @param[in, out] uniqueNodes The nodes container for ensuring uniqueness
          * @param[in] options The options to use
+         * @param[in] referenced The sorted ids of the nodes to load (all nodes are loaded if 0)
          */
         NodesHandler(std::map<long long int, NIOSMNode*>& toFill, std::set<NIOSMNode*,
                      CompareNodes>& uniqueNodes,
-                     const OptionsCont& cont);
+                     const OptionsCont& cont,
+                     const std::vector<long long int>* referenced = 0);
 
 
         /// @brief Destructor
@@ -351,6 +376,9 @@ protected:
         /// @brief the options
         const OptionsCont& myOptionsCont;
 
+        /// @brief the sorted ids of the nodes to load (0 for all nodes)
+        const std::vector<long long int>* const myReferenced;
+
 
     private:
         /** @brief invalidated copy constructor */
@@ -362,6 +390,63 @@ protected:
     };
 
 
+    /**
+     * @class ReferencedNodesHandler
+     * @brief A class which collects the ids of the nodes referenced by ways and relations
+     *
+     * Large extracts contain many nodes which are not part of any way (points of
+     *  interest, building outlines are ways though). Collecting the references
+     *  first allows to store only the nodes which may be needed.
+     */
+    class ReferencedNodesHandler : public SUMOSAXHandler {
+    public:
+        /** @brief Contructor
+         * @param[in, out] toFill The container to add the referenced node ids to
+         */
+        ReferencedNodesHandler(std::vector<long long int>& toFill);
+
+
+        /// @brief Destructor
+        ~ReferencedNodesHandler() override;
+
+
+        /// @brief sorts the collected ids and removes duplicates
+        void compact();
+
+
+    protected:
+        /// @name inherited from GenericSAXHandler
+        //@{
+
+        /** @brief Called on the opening of a tag;
+         *
+         * @param[in] element ID of the currently opened element
+         * @param[in] attrs Attributes within the currently opened element
+         * @exception ProcessError If something fails
+         * @see GenericSAXHandler::myStartElement
+         */
+        void myStartElement(int element, const SUMOSAXAttributes& attrs) override;
+        //@}
+
+
+    private:
+        /// @brief The container of referenced node ids
+        std::vector<long long int>& myToFill;
+
+        /// @brief The number of distinct ids after the last compaction
+        int myCompactSize;
+
+
+    private:
+        /** @brief invalidated copy constructor */
+        ReferencedNodesHandler(const ReferencedNodesHandler& s);
+
+        /** @brief invalidated assignment operator */
+        ReferencedNodesHandler& operator=(const ReferencedNodesHandler& s);
+
+    };
+
+
     /**
      * @class EdgesHandler
      * @brief A class which extracts OSM-edges from a parsed OSM-file
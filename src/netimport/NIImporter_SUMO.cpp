@@ -78,7 +78,8 @@ NIImporter_SUMO::NIImporter_SUMO(NBNetBuilder& nb)
       myCornerDetail(0),
       myLinkDetail(-1),
       myRectLaneCut(false),
-      myWalkingAreas(false) {
+      myWalkingAreas(false),
+      myKeepJunctionShapes(false) {
 }
 
 
@@ -100,6 +101,7 @@ NIImporter_SUMO::_loadNetwork(OptionsCont& oc) {
     if (!oc.isUsableFileList("sumo-net-file")) {
         return;
     }
+    myKeepJunctionShapes = oc.getBool("junctions.keep-loaded-shapes");
     // parse file(s)
     NIXMLTypesHandler* typesHandler = new NIXMLTypesHandler(myNetBuilder.getTypeCont());
     std::vector<std::string> files = oc.getStringVector("sumo-net-file");
@@ -276,6 +278,22 @@ NIImporter_SUMO::_loadNetwork(OptionsCont& oc) {
                 NBConnection(prohibitedFrom, prohibitedTo));
         }
     }
+    // the loaded shapes only fit if the junction geometry is configured as for the loaded network
+    //  (the default radius is not stored in the network, so it must not be changed either)
+    if (!myJunctionShapes.empty()
+            && ((!oc.isDefault("lefthand") && oc.getBool("lefthand") != myAmLefthand)
+                || (!oc.isDefault("junctions.corner-detail") && oc.getInt("junctions.corner-detail") != myCornerDetail)
+                || (!oc.isDefault("junctions.internal-link-detail") && oc.getInt("junctions.internal-link-detail") != myLinkDetail)
+                || (!oc.isDefault("rectangular-lane-cut") && oc.getBool("rectangular-lane-cut") != myRectLaneCut)
+                || !oc.isDefault("default.junctions.radius"))) {
+        WRITE_WARNING("Recomputing all junction shapes since the junction geometry options differ from the loaded network.");
+        myJunctionShapes.clear();
+    }
+    // keep the junction shapes as long as the edges (all built now) do not change
+    for (std::map<NBNode*, PositionVector>::const_iterator it = myJunctionShapes.begin(); it != myJunctionShapes.end(); ++it) {
+        it->first->setLoadedShape(it->second);
+    }
+    myJunctionShapes.clear();
     if (!myHaveSeenInternalEdge) {
         myNetBuilder.haveLoadedNetworkWithoutInternalEdges();
     }
@@ -668,6 +686,10 @@ NIImporter_SUMO::addJunction(const SUMOSAXAttributes& attrs) {
     // handle custom shape
     if (attrs.getOpt<bool>(SUMO_ATTR_CUSTOMSHAPE, 0, ok, false)) {
         node->setCustomShape(attrs.get<PositionVector>(SUMO_ATTR_SHAPE, id.c_str(), ok));
+    } else if (myKeepJunctionShapes) {
+        PositionVector shape = attrs.getOpt<PositionVector>(SUMO_ATTR_SHAPE, id.c_str(), ok, PositionVector());
+        NBNetBuilder::transformCoordinates(shape, false, myLocation);
+        myJunctionShapes[node] = shape;
     }
     if (type == NODETYPE_RAIL_SIGNAL || type == NODETYPE_RAIL_CROSSING) {
         // both types of nodes come without a tlLogic
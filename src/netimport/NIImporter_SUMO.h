@@ -377,6 +377,12 @@ private:
     /// @brief list of node id with rail signals (no NBTrafficLightDefinition exists)
     std::set<std::string> myRailSignals;
 
+    /// @brief whether junction shapes shall be kept for junctions with unmodified edges
+    bool myKeepJunctionShapes;
+
+    /// @brief the loaded junction shapes (only filled if they shall be kept)
+    std::map<NBNode*, PositionVector> myJunctionShapes;
+
     /** @brief Parses lane index from lane ID an retrieve lane from EdgeAttrs
      * @param[in] edge The EdgeAttrs* which should contain the lane
      * @param[in] lane_id The ID of the lane
@@ -90,22 +90,39 @@ NWWriter_SUMO::writeNetwork(const OptionsCont& oc, NBNetBuilder& nb) {
     // write edge types and restrictions
     nb.getTypeCont().writeTypes(device);
 
-    // write inner lanes
-    if (!oc.getBool("no-internal-links")) {
-        bool hadAny = false;
+    const int numThreads = oc.getInt("threads");
+    if (numThreads > 1 && !device.isBinary()) {
+        // the traffic light definitions lazily compute data needed for the junction logics,
+        // do this before the junctions are written in parallel
         for (std::map<std::string, NBNode*>::const_iterator i = nc.begin(); i != nc.end(); ++i) {
-            hadAny |= writeInternalEdges(device, ec, *(*i).second);
+            const std::set<NBTrafficLightDefinition*>& defs = (*i).second->getControllingTLS();
+            for (std::set<NBTrafficLightDefinition*>::const_iterator it = defs.begin(); it != defs.end(); ++it) {
+                (*it)->needsCont(0, 0, 0, 0);
+                (*it)->rightOnRedConflict(-1, -1);
+            }
         }
-        if (hadAny) {
+    }
+    SectionContent content;
+    content.ec = &ec;
+    content.noNames = !oc.getBool("output.street-names");
+    for (std::map<std::string, NBNode*>::const_iterator i = nc.begin(); i != nc.end(); ++i) {
+        content.nodes.push_back((*i).second);
+    }
+    for (std::map<std::string, NBEdge*>::const_iterator i = ec.begin(); i != ec.end(); ++i) {
+        content.edges.push_back((*i).second);
+    }
+
+    // write inner lanes
+    if (!oc.getBool("no-internal-links")) {
+        content.section = SECTION_INTERNAL_EDGES;
+        if (writeSection(device, content, numThreads)) {
             device.lf();
         }
     }
 
     // write edges with lanes and connected edges
-    bool noNames = !oc.getBool("output.street-names");
-    for (std::map<std::string, NBEdge*>::const_iterator i = ec.begin(); i != ec.end(); ++i) {
-        writeEdge(device, *(*i).second, noNames);
-    }
+    content.section = SECTION_EDGES;
+    writeSection(device, content, numThreads);
     device.lf();
 
     // write tls logics
@@ -124,9 +141,10 @@ NWWriter_SUMO::writeNetwork(const OptionsCont& oc, NBNetBuilder& nb) {
         }
     }
     for (std::map<std::string, NBNode*>::const_iterator i = nc.begin(); i != nc.end(); ++i) {
-        const bool checkLaneFoes = checkLaneFoesAll || (checkLaneFoesRoundabout && roundaboutNodes.count((*i).second) > 0);
-        writeJunction(device, *(*i).second, checkLaneFoes);
+        content.checkLaneFoes.push_back(checkLaneFoesAll || (checkLaneFoesRoundabout && roundaboutNodes.count((*i).second) > 0));
     }
+    content.section = SECTION_JUNCTIONS;
+    writeSection(device, content, numThreads);
     device.lf();
     const bool includeInternal = !oc.getBool("no-internal-links");
     if (includeInternal) {
@@ -251,6 +269,65 @@ NWWriter_SUMO::getOppositeInternalID(const NBEdgeCont& ec, const NBEdge* from, c
 }
 
 
+bool
+NWWriter_SUMO::writeSection(OutputDevice& into, const SectionContent& content, const int numThreads) {
+    const int size = (int)(content.section == SECTION_EDGES ? content.edges.size() : content.nodes.size());
+#ifdef HAVE_FOX
+    if (numThreads > 1 && size > 1 && !into.isBinary()) {
+        FXWorkerThread::Pool threadPool(numThreads);
+        // use more chunks than threads because the elements differ largely in size
+        const int numChunks = MIN2(size, 4 * numThreads);
+        std::vector<WriteTask*> tasks;
+        for (int i = 0; i < numChunks; i++) {
+            tasks.push_back(new WriteTask(content, (int)((long long int)size * i / numChunks), (int)((long long int)size * (i + 1) / numChunks)));
+            threadPool.add(tasks.back());
+        }
+        threadPool.waitAll(false);
+        bool hadAny = false;
+        for (std::vector<WriteTask*>::const_iterator it = tasks.begin(); it != tasks.end(); ++it) {
+            into << (*it)->getString();
+            hadAny |= (*it)->hadAny();
+            delete *it;
+        }
+        return hadAny;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
+    return writeSectionPart(into, content, 0, size);
+}
+
+
+bool
+NWWriter_SUMO::writeSectionPart(OutputDevice& into, const SectionContent& content, const int begin, const int end) {
+    bool hadAny = false;
+    for (int i = begin; i < end; i++) {
+        switch (content.section) {
+            case SECTION_INTERNAL_EDGES:
+                hadAny |= writeInternalEdges(into, *content.ec, *content.nodes[i]);
+                break;
+            case SECTION_EDGES:
+                writeEdge(into, *content.edges[i], content.noNames);
+                hadAny = true;
+                break;
+            case SECTION_JUNCTIONS:
+                writeJunction(into, *content.nodes[i], content.checkLaneFoes[i]);
+                hadAny = true;
+                break;
+        }
+    }
+    return hadAny;
+}
+
+
+#ifdef HAVE_FOX
+void
+NWWriter_SUMO::WriteTask::run(FXWorkerThread* /* context */) {
+    myHadAny = writeSectionPart(myDevice, myContent, myBegin, myEnd);
+}
+#endif
+
+
 bool
 NWWriter_SUMO::writeInternalEdges(OutputDevice& into, const NBEdgeCont& ec, const NBNode& n) {
     bool ret = false;
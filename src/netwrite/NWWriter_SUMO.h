@@ -32,6 +32,10 @@
 #include <utils/xml/SUMOSAXHandler.h>
 #include <utils/common/UtilExceptions.h>
 #include <netbuild/NBConnectionDefs.h>
+#include <utils/iodevices/OutputDevice_String.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -102,6 +106,69 @@ public:
 
 
 private:
+    /// @brief the parts of the network which are written node- or edge-wise (in parallel if possible)
+    enum Section {
+        SECTION_INTERNAL_EDGES,
+        SECTION_EDGES,
+        SECTION_JUNCTIONS
+    };
+
+    /// @brief the elements of a section together with the settings needed for writing them
+    struct SectionContent {
+        Section section;
+        const NBEdgeCont* ec;
+        std::vector<const NBNode*> nodes;
+        std::vector<const NBEdge*> edges;
+        /// @brief whether lane foes shall be checked (one entry per node, junctions only)
+        std::vector<bool> checkLaneFoes;
+        bool noNames;
+    };
+
+    /** @brief Writes all elements of the given section
+     *
+     * Using more than one thread, chunks of consecutive elements are formatted
+     *  into separate buffers which are then appended in order, so the output
+     *  does not depend on the number of threads. Binary output is always
+     *  written sequentially.
+     *
+     * @param[in] into The device to write the section into
+     * @param[in] content The elements to write
+     * @param[in] numThreads The number of threads to use
+     * @return Whether anything was written
+     */
+    static bool writeSection(OutputDevice& into, const SectionContent& content, const int numThreads);
+
+    /// @brief writes the elements of the section with indices in [begin, end)
+    static bool writeSectionPart(OutputDevice& into, const SectionContent& content, const int begin, const int end);
+
+#ifdef HAVE_FOX
+    /**
+     * @class WriteTask
+     * @brief Formats a chunk of a section into its own buffer
+     */
+    class WriteTask : public FXWorkerThread::Task {
+    public:
+        WriteTask(const SectionContent& content, const int begin, const int end)
+            : myContent(content), myBegin(begin), myEnd(end), myDevice(false, 1), myHadAny(false) {}
+        void run(FXWorkerThread* context);
+        bool hadAny() const {
+            return myHadAny;
+        }
+        std::string getString() const {
+            return myDevice.getString();
+        }
+    private:
+        const SectionContent& myContent;
+        const int myBegin;
+        const int myEnd;
+        OutputDevice_String myDevice;
+        bool myHadAny;
+    private:
+        /// @brief Invalidated assignment operator.
+        WriteTask& operator=(const WriteTask&) = delete;
+    };
+#endif
+
     /// @name Methods for writing network parts
     /// @{
 
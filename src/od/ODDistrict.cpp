@@ -56,14 +56,14 @@ ODDistrict::addSink(const std::string& id, double weight) {
 
 
 std::string
-ODDistrict::getRandomSource() const {
-    return mySources.get();
+ODDistrict::getRandomSource(std::mt19937* rng) const {
+    return mySources.get(rng);
 }
 
 
 std::string
-ODDistrict::getRandomSink() const {
-    return mySinks.get();
+ODDistrict::getRandomSink(std::mt19937* rng) const {
+    return mySinks.get(rng);
 }
 
 
@@ -92,10 +92,11 @@ public:
      * If the list of this district's sources is empty, an OutOfBoundsException
      *  -exception is thrown.
      *
+     * @param[in] rng The random number generator to use (the global one if 0)
      * @return One of this district's sources chosen randomly regarding their weights
      * @exception OutOfBoundsException If this district has no sources
      */
-    std::string getRandomSource() const;
+    std::string getRandomSource(std::mt19937* rng = 0) const;
 
 
     /** @brief Returns the id of a sink to use
@@ -103,10 +104,11 @@ public:
      * If the list of this district's sinks is empty, an OutOfBoundsException
      *  -exception is thrown.
      *
+     * @param[in] rng The random number generator to use (the global one if 0)
      * @return One of this district's sinks chosen randomly regarding their weights
      * @exception OutOfBoundsException If this district has no sinks
      */
-    std::string getRandomSink() const;
+    std::string getRandomSink(std::mt19937* rng = 0) const;
 
 
     /** @brief Returns the number of sinks
@@ -28,6 +28,7 @@
 #include <algorithm>
 #include <list>
 #include <iterator>
+#include <limits>
 #include <utils/options/OptionsCont.h>
 #include <utils/common/StdDefs.h>
 #include <utils/common/MsgHandler.h>
@@ -152,28 +153,58 @@ ODMatrix::computeDeparts(ODCell* cell,
         return cell->vehicleNumber;
     }
 
-    const double offset = (double)(cell->end - cell->begin) / (double) vehicles2insert / (double) 2.;
-    for (int i = 0; i < vehicles2insert; ++i) {
+    const int oldSize = (int)into.size();
+    if (expandCell(cell, vehicles2insert, vehName, into, uniform, differSourceSink, prefix, 0) > 0) {
+        for (std::vector<ODVehicle>::const_iterator i = into.begin() + oldSize; i != into.end(); ++i) {
+            if (i->to == i->from) {
+                WRITE_WARNING("Cannot find different source and sink edge for origin '" + cell->origin + "' and destination '" + cell->destination + "'.");
+            }
+        }
+    }
+    vehName += vehicles2insert;
+    return cell->vehicleNumber - vehicles2insert;
+}
+
+
+int
+ODMatrix::expandCell(const ODCell* const cell, const int number, const int firstIndex,
+                     std::vector<ODVehicle>& into, const bool uniform, const bool differSourceSink,
+                     const std::string& prefix, std::mt19937* rng) const {
+    int numSame = 0;
+    const double offset = (double)(cell->end - cell->begin) / (double) number / (double) 2.;
+    const bool canDiffer = myDistricts.get(cell->origin)->sourceNumber() > 1 || myDistricts.get(cell->destination)->sinkNumber() > 1;
+    for (int i = 0; i < number; ++i) {
         ODVehicle veh;
-        veh.id = prefix + toString(vehName++);
+        veh.id = prefix + toString(firstIndex + i);
 
         if (uniform) {
-            veh.depart = (SUMOTime)(offset + cell->begin + ((double)(cell->end - cell->begin) * (double) i / (double) vehicles2insert));
+            veh.depart = (SUMOTime)(offset + cell->begin + ((double)(cell->end - cell->begin) * (double) i / (double) number));
         } else {
-            veh.depart = (SUMOTime)RandHelper::rand(cell->begin, cell->end);
+            veh.depart = (SUMOTime)RandHelper::rand(cell->begin, cell->end, rng);
         }
-        const bool canDiffer = myDistricts.get(cell->origin)->sourceNumber() > 1 || myDistricts.get(cell->destination)->sinkNumber() > 1;
         do {
-            veh.from = myDistricts.getRandomSourceFromDistrict(cell->origin);
-            veh.to = myDistricts.getRandomSinkFromDistrict(cell->destination);
+            veh.from = myDistricts.getRandomSourceFromDistrict(cell->origin, rng);
+            veh.to = myDistricts.getRandomSinkFromDistrict(cell->destination, rng);
         } while (canDiffer && differSourceSink && (veh.to == veh.from));
         if (!canDiffer && differSourceSink && (veh.to == veh.from)) {
-            WRITE_WARNING("Cannot find different source and sink edge for origin '" + cell->origin + "' and destination '" + cell->destination + "'.");
+            numSame++;
         }
-        veh.cell = cell;
+        veh.cell = const_cast<ODCell*>(cell);
         into.push_back(veh);
     }
-    return cell->vehicleNumber - vehicles2insert;
+    return numSame;
+}
+
+
+void
+ODMatrix::expandSlice(ODSlice& slice, const bool uniform, const bool differSourceSink,
+                      const std::string& prefix) const {
+    std::mt19937 rng(slice.seed);
+    for (int i = 0; i < (int)slice.cells.size(); i++) {
+        slice.numSameSourceSink.push_back(expandCell(slice.cells[i], slice.numbers[i], slice.firstIndices[i],
+                                          slice.vehicles, uniform, differSourceSink, prefix, &rng));
+    }
+    sort(slice.vehicles.begin(), slice.vehicles.end(), descending_departure_comperator());
 }
 
 
@@ -211,10 +242,14 @@ ODMatrix::write(SUMOTime begin, const SUMOTime end,
                 OutputDevice& dev, const bool uniform,
                 const bool differSourceSink, const bool noVtype,
                 const std::string& prefix, const bool stepLog,
-                bool pedestrians, bool persontrips) {
+                bool pedestrians, bool persontrips, const int numThreads) {
     if (myContainer.size() == 0) {
         return;
     }
+    if (numThreads > 0) {
+        writeSliced(begin, end, dev, uniform, differSourceSink, noVtype, prefix, stepLog, pedestrians, persontrips, numThreads);
+        return;
+    }
     std::map<std::pair<std::string, std::string>, double> fractionLeft;
     int vehName = 0;
     sortByBeginTime();
@@ -254,29 +289,7 @@ ODMatrix::write(SUMOTime begin, const SUMOTime end,
         }
         for (std::vector<ODVehicle>::reverse_iterator i = vehicles.rbegin(); i != vehicles.rend() && (*i).depart == t; ++i) {
             if (t >= begin) {
-                myNumWritten++;
-                if (pedestrians) {
-                    dev.openTag(SUMO_TAG_PERSON).writeAttr(SUMO_ATTR_ID, (*i).id).writeAttr(SUMO_ATTR_DEPART, time2string(t));
-                    dev.openTag(SUMO_TAG_WALK);
-                    dev.writeAttr(SUMO_ATTR_FROM, (*i).from).writeAttr(SUMO_ATTR_TO, (*i).to);
-                    dev.writeAttr(SUMO_ATTR_DEPARTPOS, "random");
-                    dev.writeAttr(SUMO_ATTR_ARRIVALPOS, "random");
-                    dev.closeTag();
-                    dev.closeTag();
-                } else if (persontrips) {
-                    dev.openTag(SUMO_TAG_PERSON).writeAttr(SUMO_ATTR_ID, (*i).id).writeAttr(SUMO_ATTR_DEPART, time2string(t));
-                    dev.openTag(SUMO_TAG_PERSONTRIP);
-                    dev.writeAttr(SUMO_ATTR_FROM, (*i).from).writeAttr(SUMO_ATTR_TO, (*i).to);
-                    dev.writeAttr(SUMO_ATTR_DEPARTPOS, "random");
-                    dev.writeAttr(SUMO_ATTR_ARRIVALPOS, "random");
-                    dev.closeTag();
-                    dev.closeTag();
-                } else {
-                    dev.openTag(SUMO_TAG_TRIP).writeAttr(SUMO_ATTR_ID, (*i).id).writeAttr(SUMO_ATTR_DEPART, time2string(t));
-                    dev.writeAttr(SUMO_ATTR_FROM, (*i).from).writeAttr(SUMO_ATTR_TO, (*i).to);
-                    writeDefaultAttrs(dev, noVtype, i->cell);
-                    dev.closeTag();
-                }
+                writeVehicle(dev, *i, noVtype, pedestrians, persontrips);
             }
         }
         while (vehicles.size() != 0 && vehicles.back().depart == t) {
@@ -295,6 +308,126 @@ ODMatrix::write(SUMOTime begin, const SUMOTime end,
 }
 
 
+void
+ODMatrix::writeSliced(SUMOTime begin, const SUMOTime end,
+                      OutputDevice& dev, const bool uniform,
+                      const bool differSourceSink, const bool noVtype,
+                      const std::string& prefix, const bool stepLog,
+                      bool pedestrians, bool persontrips, const int numThreads) {
+    sortByBeginTime();
+    begin = MAX2(begin, myContainer.front()->begin);
+    // determine the vehicle numbers, names and seeds sequentially
+    std::map<std::pair<std::string, std::string>, double> fractionLeft;
+    std::vector<ODSlice> slices;
+    int vehName = 0;
+    for (ODCell* const cell : myContainer) {
+        if (cell->end <= begin || cell->begin >= end) {
+            continue;
+        }
+        if (slices.empty() || slices.back().begin != cell->begin) {
+            slices.push_back(ODSlice(cell->begin, RandHelper::rand(std::numeric_limits<int>::max())));
+        }
+        const std::pair<std::string, std::string> odID = std::make_pair(cell->origin, cell->destination);
+        // check whether the current cell must be extended by the last fraction
+        if (fractionLeft.find(odID) != fractionLeft.end()) {
+            cell->vehicleNumber += fractionLeft[odID];
+        }
+        int number = (int)cell->vehicleNumber;
+        // compute whether the fraction forces an additional vehicle insertion
+        if (RandHelper::rand() < cell->vehicleNumber - (double)number) {
+            number++;
+        }
+        fractionLeft[odID] = cell->vehicleNumber - number;
+        if (number > 0) {
+            ODSlice& slice = slices.back();
+            slice.cells.push_back(cell);
+            slice.numbers.push_back(number);
+            slice.firstIndices.push_back(vehName);
+            vehName += number;
+        }
+    }
+    // expand the slices in batches and merge them in the order of departure
+    const int batchSize = MAX2(1, 2 * numThreads);
+#ifdef HAVE_FOX
+    FXWorkerThread::Pool threadPool(numThreads > 1 ? numThreads : 0);
+#endif
+    std::vector<ODVehicle> vehicles;
+    for (int first = 0; first < (int)slices.size(); first += batchSize) {
+        const int last = MIN2(first + batchSize, (int)slices.size());
+        for (int i = first; i < last; i++) {
+#ifdef HAVE_FOX
+            if (threadPool.size() > 0) {
+                threadPool.add(new ExpansionTask(*this, slices[i], uniform, differSourceSink, prefix));
+                continue;
+            }
+#endif
+            expandSlice(slices[i], uniform, differSourceSink, prefix);
+        }
+#ifdef HAVE_FOX
+        threadPool.waitAll();
+#endif
+        for (int i = first; i < last; i++) {
+            ODSlice& slice = slices[i];
+            if (slice.error != "") {
+                throw ProcessError(slice.error);
+            }
+            for (int j = 0; j < (int)slice.cells.size(); j++) {
+                if (slice.numSameSourceSink[j] > 0) {
+                    WRITE_WARNING("Cannot find different source and sink edge for origin '" + slice.cells[j]->origin + "' and destination '" + slice.cells[j]->destination +
+                                  "' (" + toString(slice.numSameSourceSink[j]) + " vehicles).");
+                }
+            }
+            std::vector<ODVehicle> merged;
+            merged.reserve(vehicles.size() + slice.vehicles.size());
+            std::merge(vehicles.begin(), vehicles.end(), slice.vehicles.begin(), slice.vehicles.end(),
+                       std::back_inserter(merged), descending_departure_comperator());
+            vehicles.swap(merged);
+            std::vector<ODVehicle>().swap(slice.vehicles);
+        }
+        // all vehicles departing before the next slice begins are final
+        const SUMOTime limit = last < (int)slices.size() ? slices[last].begin : end;
+        while (!vehicles.empty() && vehicles.back().depart < limit) {
+            if (vehicles.back().depart >= begin && vehicles.back().depart < end) {
+                writeVehicle(dev, vehicles.back(), noVtype, pedestrians, persontrips);
+            }
+            vehicles.pop_back();
+        }
+        if (stepLog) {
+            std::cout << "Parsing time " + time2string(MIN2(limit, end)) << '\r';
+        }
+    }
+}
+
+
+void
+ODMatrix::writeVehicle(OutputDevice& dev, const ODVehicle& veh, const bool noVtype,
+                       bool pedestrians, bool persontrips) {
+    myNumWritten++;
+    if (pedestrians) {
+        dev.openTag(SUMO_TAG_PERSON).writeAttr(SUMO_ATTR_ID, veh.id).writeAttr(SUMO_ATTR_DEPART, time2string(veh.depart));
+        dev.openTag(SUMO_TAG_WALK);
+        dev.writeAttr(SUMO_ATTR_FROM, veh.from).writeAttr(SUMO_ATTR_TO, veh.to);
+        dev.writeAttr(SUMO_ATTR_DEPARTPOS, "random");
+        dev.writeAttr(SUMO_ATTR_ARRIVALPOS, "random");
+        dev.closeTag();
+        dev.closeTag();
+    } else if (persontrips) {
+        dev.openTag(SUMO_TAG_PERSON).writeAttr(SUMO_ATTR_ID, veh.id).writeAttr(SUMO_ATTR_DEPART, time2string(veh.depart));
+        dev.openTag(SUMO_TAG_PERSONTRIP);
+        dev.writeAttr(SUMO_ATTR_FROM, veh.from).writeAttr(SUMO_ATTR_TO, veh.to);
+        dev.writeAttr(SUMO_ATTR_DEPARTPOS, "random");
+        dev.writeAttr(SUMO_ATTR_ARRIVALPOS, "random");
+        dev.closeTag();
+        dev.closeTag();
+    } else {
+        dev.openTag(SUMO_TAG_TRIP).writeAttr(SUMO_ATTR_ID, veh.id).writeAttr(SUMO_ATTR_DEPART, time2string(veh.depart));
+        dev.writeAttr(SUMO_ATTR_FROM, veh.from).writeAttr(SUMO_ATTR_TO, veh.to);
+        writeDefaultAttrs(dev, noVtype, veh.cell);
+        dev.closeTag();
+    }
+}
+
+
 void
 ODMatrix::writeFlows(const SUMOTime begin, const SUMOTime end,
                      OutputDevice& dev, bool noVtype,
@@ -644,4 +777,19 @@ ODMatrix::sortByBeginTime() {
 }
 
 
+#ifdef HAVE_FOX
+// ---------------------------------------------------------------------------
+// ODMatrix::ExpansionTask-methods
+// ---------------------------------------------------------------------------
+void
+ODMatrix::ExpansionTask::run(FXWorkerThread* /* context */) {
+    try {
+        myMatrix.expandSlice(mySlice, myUniform, myDifferSourceSink, myPrefix);
+    } catch (std::runtime_error& e) {
+        mySlice.error = e.what();
+    }
+}
+#endif
+
+
 /****************************************************************************/
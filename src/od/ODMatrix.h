@@ -34,12 +34,16 @@
 #include <algorithm>
 #include <set>
 #include <string>
+#include <random>
 #include <utils/common/SUMOTime.h>
 #include "ODCell.h"
 #include "ODDistrictCont.h"
 #include <utils/distribution/Distribution_Points.h>
 #include <utils/importio/LineReader.h>
 #include <utils/common/SUMOTime.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 // ===========================================================================
 // class declarations
@@ -154,12 +158,16 @@ public:
      * @param[in] noVtype Whether vtype information shall not be written
      * @param[in] prefix A prefix for the vehicle names
      * @param[in] stepLog Whether processed time shall be written
+     * @param[in] pedestrians Whether pedestrians shall be written instead of vehicles
+     * @param[in] persontrips Whether persontrips shall be written instead of vehicles
+     * @param[in] numThreads The number of threads for the sliced expansion (0 for the sequential expansion)
+     * @see writeSliced
      */
     void write(SUMOTime begin, const SUMOTime end,
                OutputDevice& dev, const bool uniform,
                const bool differSourceSink, const bool noVtype,
                const std::string& prefix, const bool stepLog,
-               bool pedestrians, bool persontrips);
+               bool pedestrians, bool persontrips, const int numThreads = 0);
 
 
     /** @brief Writes the flows stored in the matrix
@@ -263,6 +271,59 @@ protected:
     };
 
 
+    /**
+     * @struct ODSlice
+     * @brief The cells starting at the same time which are expanded together
+     *
+     * The number of vehicles and the index of the first vehicle name are
+     *  determined for each cell before the expansion, so slices can be expanded
+     *  independently using their own random number generator.
+     */
+    struct ODSlice {
+        /// @brief Constructor
+        ODSlice(const SUMOTime begin, const int seed) : begin(begin), seed(seed) {}
+        /// @brief The begin time of all cells in this slice
+        SUMOTime begin;
+        /// @brief The seed of the random number generator used for the expansion
+        int seed;
+        /// @brief The cells to expand
+        std::vector<ODCell*> cells;
+        /// @brief The number of vehicles to generate for each cell
+        std::vector<int> numbers;
+        /// @brief The index of the first vehicle name for each cell
+        std::vector<int> firstIndices;
+        /// @brief The number of vehicles per cell where source and sink could not be made different
+        std::vector<int> numSameSourceSink;
+        /// @brief The generated vehicles, sorted by descending departure
+        std::vector<ODVehicle> vehicles;
+        /// @brief An error which occurred during the expansion
+        std::string error;
+    };
+
+#ifdef HAVE_FOX
+    /**
+     * @class ExpansionTask
+     * @brief A task which expands a single slice
+     */
+    class ExpansionTask : public FXWorkerThread::Task {
+    public:
+        ExpansionTask(const ODMatrix& matrix, ODSlice& slice, const bool uniform,
+                      const bool differSourceSink, const std::string& prefix)
+            : myMatrix(matrix), mySlice(slice), myUniform(uniform), myDifferSourceSink(differSourceSink), myPrefix(prefix) {}
+        void run(FXWorkerThread* context);
+    private:
+        const ODMatrix& myMatrix;
+        ODSlice& mySlice;
+        const bool myUniform;
+        const bool myDifferSourceSink;
+        const std::string& myPrefix;
+    private:
+        /// @brief Invalidated assignment operator.
+        ExpansionTask& operator=(const ExpansionTask&) = delete;
+    };
+#endif
+
+
     /** @brief Computes the vehicle departs stored in the given cell and saves them in "into"
      *
      * At first, the number of vehicles to insert is computed using the
@@ -294,6 +355,59 @@ protected:
                           const std::string& prefix);
 
 
+    /** @brief Generates the given number of vehicles for the given cell
+     *
+     * @param[in] cell The cell to use
+     * @param[in] number The number of vehicles to generate
+     * @param[in] firstIndex The index of the first generated vehicle name
+     * @param[out] into The storage to put generated vehicles into
+     * @param[in] uniform Information whether departure times shallbe uniformly spread or random
+     * @param[in] differSourceSink whether source and sink shall be different edges
+     * @param[in] prefix A prefix for the vehicle names
+     * @param[in] rng The random number generator to use (the global one if 0)
+     * @return The number of vehicles where source and sink could not be made different
+     */
+    int expandCell(const ODCell* const cell, const int number, const int firstIndex,
+                   std::vector<ODVehicle>& into, const bool uniform, const bool differSourceSink,
+                   const std::string& prefix, std::mt19937* rng) const;
+
+
+    /** @brief Generates the vehicles of all cells of the slice using its own random number generator
+     *
+     * @param[in,out] slice The slice to expand
+     * @param[in] uniform Information whether departure times shallbe uniformly spread or random
+     * @param[in] differSourceSink whether source and sink shall be different edges
+     * @param[in] prefix A prefix for the vehicle names
+     */
+    void expandSlice(ODSlice& slice, const bool uniform, const bool differSourceSink,
+                     const std::string& prefix) const;
+
+
+    /** @brief Writes the vehicles stored in the matrix expanding them slice by slice
+     *
+     * The cells are grouped into slices by their begin time. The vehicle numbers
+     *  (including the fractions carried over between cells of the same O/D pair),
+     *  the vehicle names and a random seed for each slice are determined sequentially.
+     *  The slices are then expanded in batches (concurrently if threads are given)
+     *  and merged into the output in the order of departure. Only the vehicles of
+     *  the current batch and those which depart after its end are kept in memory.
+     *
+     * The result does not depend on the number of threads.
+     *
+     * @see write
+     */
+    void writeSliced(SUMOTime begin, const SUMOTime end,
+                     OutputDevice& dev, const bool uniform,
+                     const bool differSourceSink, const bool noVtype,
+                     const std::string& prefix, const bool stepLog,
+                     bool pedestrians, bool persontrips, const int numThreads);
+
+
+    /// @brief Writes a single vehicle (or person) definition
+    void writeVehicle(OutputDevice& dev, const ODVehicle& veh, const bool noVtype,
+                      bool pedestrians, bool persontrips);
+
+
     /** @brief Splits the given cell dividing it on the given time line and
      *          storing the results in the given container
      *
@@ -144,6 +144,9 @@ fillOptions() {
     oc.doRegister("timeline.day-in-hours", new Option_Bool(false));
     oc.addDescription("timeline.day-in-hours", "Processing", "Uses STR as a 24h-timeline definition");
 
+    oc.doRegister("expansion-threads", new Option_Integer(0));
+    oc.addDescription("expansion-threads", "Processing", "Expands the matrix slice by slice using INT threads; 0 keeps the sequential expansion");
+
     oc.doRegister("ignore-errors", new Option_Bool(false)); // !!! describe, document
     oc.addSynonyme("ignore-errors", "dismiss-loading-errors", true);
     oc.addDescription("ignore-errors", "Processing", "Continue on broken input");
@@ -195,6 +198,16 @@ checkOptions() {
         WRITE_ERROR("Only of the the options 'pedestrians' and 'persontrips' may be set.");
         ok = false;
     }
+    if (oc.getInt("expansion-threads") < 0) {
+        WRITE_ERROR("The number of expansion threads must not be negative.");
+        ok = false;
+    }
+#ifndef HAVE_FOX
+    if (oc.getInt("expansion-threads") > 1) {
+        WRITE_ERROR("Parallel expansion is only possible when compiled with Fox.");
+        ok = false;
+    }
+#endif
     //
     SUMOVehicleParameter p;
     std::string error;
@@ -288,7 +301,8 @@ main(int argc, char** argv) {
                          oc.getBool("ignore-vehicle-type"),
                          oc.getString("prefix"), !oc.getBool("no-step-log"),
                          oc.getBool("pedestrians"),
-                         oc.getBool("persontrips"));
+                         oc.getBool("persontrips"),
+                         oc.getInt("expansion-threads"));
             haveOutput = true;
         }
         if (OutputDevice::createDeviceByOption("flow-output", "routes", "routes_file.xsd")) {
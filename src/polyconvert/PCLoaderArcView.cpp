@@ -265,6 +265,7 @@ PCLoaderArcView::load(const std::string& file, OptionsCont& oc, PCPolyContainer&
             }
         }
         OGRFeature::DestroyFeature(poFeature);
+        toFill.flushIfFull();
     }
 #if GDAL_VERSION_MAJOR < 2
     OGRDataSource::DestroyDataSource(poDS);
@@ -161,6 +161,7 @@ PCLoaderDlrNavteq::loadPOIFile(const std::string& file,
         if (!discard) {
             PointOfInterest* poi = new PointOfInterest(name, type, color, pos, false, "", 0, 0, layer);
             toFill.add(poi, OptionsCont::getOptions().isInStringVector("prune.keep-list", name));
+            toFill.flushIfFull();
         }
     }
 }
@@ -213,7 +214,7 @@ PCLoaderDlrNavteq::loadPolyFile(const std::string& file,
         }
 
         name = StringUtils::convertUmlaute(name);
-        if (name == "noname" || toFill.getPolygons().get(name) != 0) {
+        if (name == "noname" || toFill.hasPolygon(name)) {
             name = name + "#" + toString(toFill.getEnumIDFor(name));
         }
 
@@ -248,6 +249,7 @@ PCLoaderDlrNavteq::loadPolyFile(const std::string& file,
         if (!discard) {
             SUMOPolygon* poly = new SUMOPolygon(name, type, color, vec, false, fill, layer);
             toFill.add(poly);
+            toFill.flushIfFull();
         }
         vec.clear();
     }
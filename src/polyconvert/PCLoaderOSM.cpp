@@ -201,7 +201,8 @@ PCLoaderOSM::loadIfSet(OptionsCont& oc, PCPolyContainer& toFill,
         }
     }
 
-    // instatiate polygons
+    // collect the polygons and pois to build
+    std::vector<PCOSMEdge*> polyEdges;
     for (EdgeMap::iterator i = edges.begin(); i != edges.end(); ++i) {
         PCOSMEdge* e = (*i).second;
         if (e->myAttributes.size() == 0) {
@@ -216,71 +217,115 @@ PCLoaderOSM::loadIfSet(OptionsCont& oc, PCPolyContainer& toFill,
             WRITE_ERROR("Polygon '" + toString(e->id) + "' has no shape.");
             continue;
         }
-        // compute shape
-        PositionVector vec;
-        for (std::vector<long long int>::iterator j = e->myCurrentNodes.begin(); j != e->myCurrentNodes.end(); ++j) {
-            PCOSMNode* n = nodes.find(*j)->second;
-            Position pos(n->lon, n->lat);
-            if (!GeoConvHelper::getProcessing().x2cartesian(pos)) {
-                WRITE_WARNING("Unable to project coordinates for polygon '" + toString(e->id) + "'.");
+        polyEdges.push_back(e);
+    }
+    std::vector<PCOSMNode*> poiNodes;
+    for (std::map<long long int, PCOSMNode*>::iterator i = nodes.begin(); i != nodes.end(); ++i) {
+        if ((*i).second->myAttributes.size() != 0) {
+            poiNodes.push_back((*i).second);
+        }
+    }
+    // the elements are projected and type mapped in batches (in parallel if threads are given) and added afterwards
+    const int numThreads = oc.getInt("threads");
+    const int batchSize = oc.getInt("output.batch-size") > 0 ? oc.getInt("output.batch-size") : MAX2((int)polyEdges.size(), (int)poiNodes.size());
+#ifdef HAVE_FOX
+    FXWorkerThread::Pool threadPool;
+    std::vector<WorkerThread*> workers;
+#endif
+
+    // instatiate polygons
+    for (int begin = 0; begin < (int)polyEdges.size(); begin += batchSize) {
+        const int end = MIN2(begin + batchSize, (int)polyEdges.size());
+        std::vector<PCOSMNode*> toProject;
+        AttributesVector attributes;
+        for (int i = begin; i < end; i++) {
+            for (long long int nodeID : polyEdges[i]->myCurrentNodes) {
+                PCOSMNode* n = nodes.find(nodeID)->second;
+                if (!n->projected) {
+                    n->projected = true;
+                    toProject.push_back(n);
+                }
             }
-            vec.push_back_noDoublePos(pos);
-        }
-        const bool ignorePruning = OptionsCont::getOptions().isInStringVector("prune.keep-list", toString(e->id));
-        // add as many polygons as keys match defined types
-        int index = 0;
-        std::string unknownPolyType = "";
-        for (std::map<std::string, std::string>::iterator it = e->myAttributes.begin(); it != e->myAttributes.end(); ++it) {
-            const std::string& key = it->first;
-            const std::string& value = it->second;
-            const std::string fullType = key + "." + value;
-            if (tm.has(key + "." + value)) {
-                index = addPolygon(e, vec, tm.get(fullType), fullType, index, useName, toFill, ignorePruning, withAttributes);
-            } else if (tm.has(key)) {
-                index = addPolygon(e, vec, tm.get(key), fullType, index, useName, toFill, ignorePruning, withAttributes);
-            } else if (MyKeysToInclude.count(key) > 0) {
-                unknownPolyType = fullType;
+            attributes.push_back(&polyEdges[i]->myAttributes);
+        }
+        std::vector<TypeMatch> matches(attributes.size());
+        processBatch(toProject, attributes, matches, tm, numThreads
+#ifdef HAVE_FOX
+                     , threadPool, workers
+#endif
+                    );
+        for (int i = begin; i < end; i++) {
+            PCOSMEdge* e = polyEdges[i];
+            // compute shape
+            PositionVector vec;
+            for (std::vector<long long int>::iterator j = e->myCurrentNodes.begin(); j != e->myCurrentNodes.end(); ++j) {
+                PCOSMNode* n = nodes.find(*j)->second;
+                if (!n->projectionOK) {
+                    WRITE_WARNING("Unable to project coordinates for polygon '" + toString(e->id) + "'.");
+                }
+                vec.push_back_noDoublePos(n->pos);
             }
-        }
-        const PCTypeMap::TypeDef& def = tm.getDefault();
-        if (index == 0 && !def.discard && unknownPolyType != "") {
-            addPolygon(e, vec, def, unknownPolyType, index, useName, toFill, ignorePruning, withAttributes);
+            const bool ignorePruning = OptionsCont::getOptions().isInStringVector("prune.keep-list", toString(e->id));
+            // add as many polygons as keys match defined types
+            int index = 0;
+            const TypeMatch& match = matches[i - begin];
+            for (std::vector<std::pair<const PCTypeMap::TypeDef*, std::string> >::const_iterator it = match.defs.begin(); it != match.defs.end(); ++it) {
+                index = addPolygon(e, vec, *it->first, it->second, index, useName, toFill, ignorePruning, withAttributes);
+            }
+            const PCTypeMap::TypeDef& def = tm.getDefault();
+            if (index == 0 && !def.discard && match.unknownType != "") {
+                addPolygon(e, vec, def, match.unknownType, index, useName, toFill, ignorePruning, withAttributes);
+            }
+            toFill.flushIfFull();
         }
     }
 
 
     // instantiate pois
-    for (std::map<long long int, PCOSMNode*>::iterator i = nodes.begin(); i != nodes.end(); ++i) {
-        PCOSMNode* n = (*i).second;
-        if (n->myAttributes.size() == 0) {
-            // cannot be relevant as a poi
-            continue;
-        }
-        Position pos(n->lon, n->lat);
-        if (!GeoConvHelper::getProcessing().x2cartesian(pos)) {
-            WRITE_WARNING("Unable to project coordinates for POI '" + toString(n->id) + "'.");
-        }
-        const bool ignorePruning = OptionsCont::getOptions().isInStringVector("prune.keep-list", toString(n->id));
-        // add as many POIs as keys match defined types
-        int index = 0;
-        std::string unKnownPOIType = "";
-        for (std::map<std::string, std::string>::iterator it = n->myAttributes.begin(); it != n->myAttributes.end(); ++it) {
-            const std::string& key = it->first;
-            const std::string& value = it->second;
-            const std::string fullType = key + "." + value;
-            if (tm.has(key + "." + value)) {
-                index = addPOI(n, pos, tm.get(fullType), fullType, index, useName, toFill, ignorePruning, withAttributes);
-            } else if (tm.has(key)) {
-                index = addPOI(n, pos, tm.get(key), fullType, index, useName, toFill, ignorePruning, withAttributes);
-            } else if (MyKeysToInclude.count(key) > 0) {
-                unKnownPOIType = fullType;
+    for (int begin = 0; begin < (int)poiNodes.size(); begin += batchSize) {
+        const int end = MIN2(begin + batchSize, (int)poiNodes.size());
+        std::vector<PCOSMNode*> toProject;
+        AttributesVector attributes;
+        for (int i = begin; i < end; i++) {
+            PCOSMNode* n = poiNodes[i];
+            if (!n->projected) {
+                n->projected = true;
+                toProject.push_back(n);
             }
+            attributes.push_back(&n->myAttributes);
+        }
+        std::vector<TypeMatch> matches(attributes.size());
+        processBatch(toProject, attributes, matches, tm, numThreads
+#ifdef HAVE_FOX
+                     , threadPool, workers
+#endif
+                    );
+        for (int i = begin; i < end; i++) {
+            PCOSMNode* n = poiNodes[i];
+            if (!n->projectionOK) {
+                WRITE_WARNING("Unable to project coordinates for POI '" + toString(n->id) + "'.");
+            }
+            const Position& pos = n->pos;
+            const bool ignorePruning = OptionsCont::getOptions().isInStringVector("prune.keep-list", toString(n->id));
+            // add as many POIs as keys match defined types
+            int index = 0;
+            const TypeMatch& match = matches[i - begin];
+            for (std::vector<std::pair<const PCTypeMap::TypeDef*, std::string> >::const_iterator it = match.defs.begin(); it != match.defs.end(); ++it) {
+                index = addPOI(n, pos, *it->first, it->second, index, useName, toFill, ignorePruning, withAttributes);
+            }
+            const PCTypeMap::TypeDef& def = tm.getDefault();
+            if (index == 0 && !def.discard && match.unknownType != "") {
+                addPOI(n, pos, def, match.unknownType, index, useName, toFill, ignorePruning, withAttributes);
+            }
+            toFill.flushIfFull();
         }
-        const PCTypeMap::TypeDef& def = tm.getDefault();
-        if (index == 0 && !def.discard && unKnownPOIType != "") {
-            addPOI(n, pos, def, unKnownPOIType, index, useName, toFill, ignorePruning, withAttributes);
-        }
     }
+#ifdef HAVE_FOX
+    // the workers extended the boundaries of their own copies only
+    for (std::vector<WorkerThread*>::const_iterator i = workers.begin(); i != workers.end(); ++i) {
+        GeoConvHelper::getProcessing().includeBoundaries((*i)->getProjection());
+    }
+#endif
     // delete nodes
     for (std::map<long long int, PCOSMNode*>::const_iterator i = nodes.begin(); i != nodes.end(); ++i) {
         delete(*i).second;
@@ -299,11 +344,110 @@ PCLoaderOSM::loadIfSet(OptionsCont& oc, PCPolyContainer& toFill,
 Position 
 PCLoaderOSM::getEndPosition(PCOSMEdge* e, bool start, const std::map<long long int, PCOSMNode*>& nodes) {
     PCOSMNode* n = nodes.find(start ? e->myCurrentNodes.front() : e->myCurrentNodes.back())->second;
-    Position pos(n->lon, n->lat);
-    GeoConvHelper::getProcessing().x2cartesian(pos);
-    return pos;
+    project(n);
+    return n->pos;
+}
+
+
+bool
+PCLoaderOSM::project(PCOSMNode* n) {
+    if (!n->projected) {
+        n->pos = Position(n->lon, n->lat);
+        n->projectionOK = GeoConvHelper::getProcessing().x2cartesian(n->pos);
+        n->projected = true;
+    }
+    return n->projectionOK;
+}
+
+void
+PCLoaderOSM::projectNodes(const std::vector<PCOSMNode*>& nodes, const int begin, const int end, GeoConvHelper& projection) {
+    PositionVector positions;
+    for (int i = begin; i < end; i++) {
+        positions.push_back(Position(nodes[i]->lon, nodes[i]->lat));
+    }
+    const bool ok = projection.x2cartesian(positions);
+    for (int i = begin; i < end; i++) {
+        PCOSMNode* const n = nodes[i];
+        const Position orig(n->lon, n->lat);
+        n->pos = positions[i - begin];
+        // positions which could not be converted are left unchanged
+        n->projectionOK = ok || n->pos != orig;
+    }
+}
+
+
+void
+PCLoaderOSM::mapTypes(const std::map<std::string, std::string>& attributes, PCTypeMap& tm, TypeMatch& into) {
+    for (std::map<std::string, std::string>::const_iterator it = attributes.begin(); it != attributes.end(); ++it) {
+        const std::string& key = it->first;
+        const std::string& value = it->second;
+        const std::string fullType = key + "." + value;
+        if (tm.has(fullType)) {
+            into.defs.push_back(std::make_pair(&tm.get(fullType), fullType));
+        } else if (tm.has(key)) {
+            into.defs.push_back(std::make_pair(&tm.get(key), fullType));
+        } else if (MyKeysToInclude.count(key) > 0) {
+            into.unknownType = fullType;
+        }
+    }
+}
+
+
+void
+PCLoaderOSM::processBatch(const std::vector<PCOSMNode*>& toProject, const AttributesVector& attributes,
+                          std::vector<TypeMatch>& matches, PCTypeMap& tm, const int numThreads
+#ifdef HAVE_FOX
+                          , FXWorkerThread::Pool& threadPool, std::vector<WorkerThread*>& workers
+#endif
+                         ) {
+    int begin = 0;
+#ifdef HAVE_FOX
+    if (numThreads > 1 && workers.empty()) {
+        // the projection may be initialised on first use, so the workers copy it after the first success
+        bool initialised = false;
+        while (begin < (int)toProject.size() && !initialised) {
+            PCOSMNode* const n = toProject[begin++];
+            n->pos = Position(n->lon, n->lat);
+            n->projectionOK = GeoConvHelper::getProcessing().x2cartesian(n->pos);
+            initialised = n->projectionOK;
+        }
+        if (initialised) {
+            for (int i = 0; i < numThreads; i++) {
+                workers.push_back(new WorkerThread(threadPool));
+            }
+        }
+    }
+    if (!workers.empty()) {
+        const int numNodes = (int)toProject.size() - begin;
+        const int numAttributes = (int)attributes.size();
+        for (int i = 0; i < numThreads; i++) {
+            threadPool.add(new BatchTask(toProject, begin + numNodes * i / numThreads, begin + numNodes * (i + 1) / numThreads,
+                                         attributes, matches, numAttributes * i / numThreads, numAttributes * (i + 1) / numThreads, tm), i);
+        }
+        threadPool.waitAll();
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
+    projectNodes(toProject, begin, (int)toProject.size(), GeoConvHelper::getProcessing());
+    for (int i = 0; i < (int)attributes.size(); i++) {
+        mapTypes(*attributes[i], tm, matches[i]);
+    }
 }
 
+
+#ifdef HAVE_FOX
+void
+PCLoaderOSM::BatchTask::run(FXWorkerThread* context) {
+    projectNodes(myNodes, myNodesBegin, myNodesEnd, static_cast<WorkerThread*>(context)->getProjection());
+    for (int i = myAttributesBegin; i < myAttributesEnd; i++) {
+        mapTypes(*myAttributes[i], myTypeMap, myMatches[i]);
+    }
+}
+#endif
+
+
 int
 PCLoaderOSM::addPolygon(const PCOSMEdge* edge, const PositionVector& vec, const PCTypeMap::TypeDef& def, const std::string& fullType, int index, bool useName, PCPolyContainer& toFill, bool ignorePruning, bool withAttributes) {
     if (def.discard) {
@@ -379,6 +523,8 @@ PCLoaderOSM::NodesHandler::myStartElement(int element, const SUMOSAXAttributes&
             //  ... so we won't report duplicate nodes
             PCOSMNode* toAdd = new PCOSMNode();
             toAdd->id = id;
+            toAdd->projected = false;
+            toAdd->projectionOK = false;
             bool ok = true;
             toAdd->lon = attrs.get<double>(SUMO_ATTR_LON, toString(id).c_str(), ok);
             toAdd->lat = attrs.get<double>(SUMO_ATTR_LAT, toString(id).c_str(), ok);
@@ -27,9 +27,14 @@
 #include <config.h>
 
 #include <string>
+#include <utils/geom/Position.h>
 #include "PCPolyContainer.h"
 #include "PCTypeMap.h"
 #include <utils/xml/SUMOSAXHandler.h>
+#include <utils/geom/GeoConvHelper.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -79,6 +84,12 @@ protected:
         std::string name;
         /// @brief Additional attributes
         std::map<std::string, std::string> myAttributes;
+        /// @brief The projected position (valid only if projected is true)
+        Position pos;
+        /// @brief Whether the position has been projected already
+        bool projected;
+        /// @brief Whether the projection was successful
+        bool projectionOK;
     };
 
 
@@ -115,9 +126,19 @@ protected:
         bool standalone;
     };
 
+    /** @brief The type definitions matching the attributes of an OSM element
+     */
+    struct TypeMatch {
+        /// @brief The matching definitions together with the full type (key.value) they were found for
+        std::vector<std::pair<const PCTypeMap::TypeDef*, std::string> > defs;
+        /// @brief The full type of an included key without a definition (if any)
+        std::string unknownType;
+    };
+
     typedef std::vector<PCOSMRelation*> Relations;
     typedef std::map<long long int, PCOSMRelation*> RelationsMap;
     typedef std::map<long long int, PCOSMEdge*> EdgeMap;
+    typedef std::vector<const std::map<std::string, std::string>*> AttributesVector;
 
 protected:
     /// @brief try add the polygon and return the next index on success
@@ -138,6 +159,91 @@ private:
     /// @brief retrieve cartesian coordinate for way start/end
     static Position getEndPosition(PCOSMEdge* e, bool start, const std::map<long long int, PCOSMNode*>& nodes);
 
+    /** @brief Projects the position of the given node (only once for nodes shared by several ways)
+     * @return Whether the projection was successful
+     */
+    static bool project(PCOSMNode* n);
+
+    /** @brief Projects the positions of the given nodes with a single batch conversion
+     * @param[in] nodes The nodes to project
+     * @param[in] begin The index of the first node to project
+     * @param[in] end The index after the last node to project
+     * @param[in] projection The coordinate transformation to use
+     */
+    static void projectNodes(const std::vector<PCOSMNode*>& nodes, const int begin, const int end, GeoConvHelper& projection);
+
+    /// @brief Finds the type definitions matching the given attributes
+    static void mapTypes(const std::map<std::string, std::string>& attributes, PCTypeMap& tm, TypeMatch& into);
+
+#ifdef HAVE_FOX
+    /**
+     * @class WorkerThread
+     * @brief A worker thread with its own copy of the processing coordinate transformation
+     *
+     * The proj objects must not be shared between threads, so every worker projects with its copy.
+     */
+    class WorkerThread : public FXWorkerThread {
+    public:
+        WorkerThread(FXWorkerThread::Pool& pool)
+            : FXWorkerThread(pool), myProjection("!", Position(), Boundary(), Boundary()) {
+            myProjection = GeoConvHelper::getProcessing();
+        }
+        virtual ~WorkerThread() {
+            stop();
+        }
+        GeoConvHelper& getProjection() {
+            return myProjection;
+        }
+    private:
+        GeoConvHelper myProjection;
+    };
+
+    /**
+     * @class BatchTask
+     * @brief A task projecting a slice of the nodes of a batch and mapping the types of a slice of its elements
+     */
+    class BatchTask : public FXWorkerThread::Task {
+    public:
+        BatchTask(const std::vector<PCOSMNode*>& nodes, const int nodesBegin, const int nodesEnd,
+                  const AttributesVector& attributes, std::vector<TypeMatch>& matches,
+                  const int attributesBegin, const int attributesEnd, PCTypeMap& tm)
+            : myNodes(nodes), myNodesBegin(nodesBegin), myNodesEnd(nodesEnd),
+              myAttributes(attributes), myMatches(matches),
+              myAttributesBegin(attributesBegin), myAttributesEnd(attributesEnd), myTypeMap(tm) {}
+        void run(FXWorkerThread* context);
+    private:
+        const std::vector<PCOSMNode*>& myNodes;
+        const int myNodesBegin;
+        const int myNodesEnd;
+        const AttributesVector& myAttributes;
+        std::vector<TypeMatch>& myMatches;
+        const int myAttributesBegin;
+        const int myAttributesEnd;
+        PCTypeMap& myTypeMap;
+    private:
+        /// @brief Invalidated assignment operator.
+        BatchTask& operator=(const BatchTask&);
+    };
+#endif
+
+    /** @brief Projects the not yet projected nodes and maps the types of the elements of a batch
+     *
+     * The work is distributed among the workers of the given pool (if any). They are started
+     *  as soon as the processing projection is initialised, since it may change on first use.
+     * @param[in] toProject The nodes to project
+     * @param[in] attributes The attributes of the elements to map
+     * @param[out] matches The type definitions found for the attributes
+     * @param[in] tm The type map to use
+     * @param[in] numThreads The number of threads to use
+     * @param[in, out] workers The workers started so far
+     */
+    static void processBatch(const std::vector<PCOSMNode*>& toProject, const AttributesVector& attributes,
+                             std::vector<TypeMatch>& matches, PCTypeMap& tm, const int numThreads
+#ifdef HAVE_FOX
+                             , FXWorkerThread::Pool& threadPool, std::vector<WorkerThread*>& workers
+#endif
+                            );
+
 protected:
     /**
      * @class NodesHandler
@@ -240,6 +240,7 @@ PCLoaderVisum::load(const std::string& file, OptionsCont& oc, PCPolyContainer& t
             if (!discard) {
                 PointOfInterest* poi = new PointOfInterest(id, type, color, pos, false, "", 0, 0, layer);
                 toFill.add(poi);
+                toFill.flushIfFull();
             }
         }
 
@@ -268,6 +269,7 @@ PCLoaderVisum::load(const std::string& file, OptionsCont& oc, PCPolyContainer& t
                 if (!discard) {
                     SUMOPolygon* poly = new SUMOPolygon(id, type, color, vec, false, false, layer);
                     toFill.add(poly);
+                    toFill.flushIfFull();
                 }
                 vec.clear();
             }
@@ -314,6 +316,7 @@ PCLoaderVisum::load(const std::string& file, OptionsCont& oc, PCPolyContainer& t
                 if (teilflaechen[flaechenelemente[area]].size() > 0) {
                     SUMOPolygon* poly = new SUMOPolygon(id, type, color, teilflaechen[flaechenelemente[area]], false, false, layer);
                     toFill.add(poly);
+                    toFill.flushIfFull();
                 } else {
                     Position pos(x, y);
                     if (!geoConvHelper.x2cartesian(pos)) {
@@ -321,6 +324,7 @@ PCLoaderVisum::load(const std::string& file, OptionsCont& oc, PCPolyContainer& t
                     }
                     PointOfInterest* poi = new PointOfInterest(id, type, color, pos, "", 0, 0, layer);
                     toFill.add(poi);
+                    toFill.flushIfFull();
                 }
             }
         }
@@ -119,6 +119,15 @@ PCLoaderXML::myStartElement(int element,
 }
 
 
+void
+PCLoaderXML::myEndElement(int element) {
+    ShapeHandler::myEndElement(element);
+    if (element == SUMO_TAG_POI || element == SUMO_TAG_POLY) {
+        static_cast<PCPolyContainer&>(myShapeContainer).flushIfFull();
+    }
+}
+
+
 Position
 PCLoaderXML::getLanePos(const std::string& poiID, const std::string& laneID, double lanePos, double lanePosLat) {
     static_cast<PCPolyContainer&>(myShapeContainer).addLanePos(poiID, laneID, lanePos, lanePosLat);
@@ -93,6 +93,16 @@ protected:
      * @see GenericSAXHandler::myStartElement
      */
     virtual void myStartElement(int element, const SUMOSAXAttributes& attrs);
+
+
+    /** @brief Called when a closing tag occurs
+     *
+     * Lets the container write the shapes loaded so far if a batch is complete.
+     *
+     * @param[in] element ID of the currently closed element
+     * @see GenericSAXHandler::myEndElement
+     */
+    virtual void myEndElement(int element);
     //@}
 
 
@@ -45,7 +45,8 @@
 PCPolyContainer::PCPolyContainer(bool prune,
                                  const Boundary& pruningBoundary,
                                  const std::vector<std::string>& removeByNames)
-    : myPruningBoundary(pruningBoundary), myDoPrune(prune),
+    : myStreamDevice(0), myStreamGeo(false), myBatchSize(0),
+      myPruningBoundary(pruningBoundary), myDoPrune(prune),
       myRemoveByNames(removeByNames) {}
 
 
@@ -71,6 +72,10 @@ PCPolyContainer::add(SUMOPolygon* poly, bool ignorePruning) {
         delete poly;
         return false;
     }
+    if (myStreamDevice != 0 && myWrittenPolygons.count(poly->getID()) > 0) {
+        delete poly;
+        return false;
+    }
     return ShapeContainer::add(poly);
 }
 
@@ -90,6 +95,10 @@ PCPolyContainer::add(PointOfInterest* poi, bool ignorePruning) {
         delete poi;
         return false;
     }
+    if (myStreamDevice != 0 && myWrittenPOIs.count(poi->getID()) > 0) {
+        delete poi;
+        return false;
+    }
     return ShapeContainer::add(poi);
 }
 
@@ -100,8 +109,49 @@ PCPolyContainer::addLanePos(const std::string& poiID, const std::string& laneID,
 }
 
 
+bool
+PCPolyContainer::hasPolygon(const std::string& id) const {
+    return myPolygons.get(id) != 0 || myWrittenPolygons.count(id) > 0;
+}
+
+
+void
+PCPolyContainer::startStreaming(const std::string& file, bool useGeo, const int batchSize) {
+    GeoConvHelper::computeFinal();
+    if (useGeo && !GeoConvHelper::getFinal().usingGeoProjection()) {
+        WRITE_WARNING("Ignoring option \"proj.plain-geo\" because no geo-conversion has been defined");
+        useGeo = false;
+    }
+    myStreamDevice = &OutputDevice::getDevice(file);
+    myStreamDevice->writeXMLHeader("additional", "additional_file.xsd");
+    if (useGeo) {
+        myStreamDevice->setPrecision(gPrecisionGeo);
+    }
+    myStreamGeo = useGeo;
+    myBatchSize = batchSize;
+}
+
+
+void
+PCPolyContainer::flushIfFull() {
+    if (myStreamDevice != 0 && myPolygons.size() + myPOIs.size() >= myBatchSize) {
+        writeBatch();
+    }
+}
+
+
 void
 PCPolyContainer::save(const std::string& file, bool useGeo) {
+    if (myStreamDevice != 0) {
+        writeBatch();
+        // the location is only known after loading everything
+        if (!myStreamGeo && GeoConvHelper::getFinal().usingGeoProjection()) {
+            GeoConvHelper::writeLocation(*myStreamDevice);
+        }
+        myStreamDevice->close();
+        myStreamDevice = 0;
+        return;
+    }
     const GeoConvHelper& gch = GeoConvHelper::getFinal();
     if (useGeo && !gch.usingGeoProjection()) {
         WRITE_WARNING("Ignoring option \"proj.plain-geo\" because no geo-conversion has been defined");
@@ -114,6 +164,13 @@ PCPolyContainer::save(const std::string& file, bool useGeo) {
     } else if (gch.usingGeoProjection()) {
         GeoConvHelper::writeLocation(out);
     }
+    writeShapes(out, useGeo);
+    out.close();
+}
+
+
+void
+PCPolyContainer::writeShapes(OutputDevice& out, bool useGeo) const {
     // write polygons
     for (auto i : myPolygons) {
         i.second->writeXML(out, useGeo);
@@ -128,7 +185,25 @@ PCPolyContainer::save(const std::string& file, bool useGeo) {
             i.second->writeXML(out, useGeo, zOffset, it->second.laneID, it->second.pos, it->second.posLat);
         }
     }
-    out.close();
+}
+
+
+void
+PCPolyContainer::writeBatch() {
+    if (myStreamGeo) {
+        // the conversion back to geo-coordinates uses the final projection
+        GeoConvHelper::computeFinal();
+    }
+    writeShapes(*myStreamDevice, myStreamGeo);
+    for (auto i : myPolygons) {
+        myWrittenPolygons.insert(i.first);
+    }
+    for (auto i : myPOIs) {
+        myWrittenPOIs.insert(i.first);
+        myLanePosPois.erase(i.first);
+    }
+    myPolygons.clear();
+    myPOIs.clear();
 }
 
 
@@ -27,6 +27,7 @@
 
 #include <string>
 #include <map>
+#include <set>
 #include <vector>
 #include <utils/shapes/ShapeContainer.h>
 
@@ -97,7 +98,34 @@ public:
 
     void addLanePos(const std::string& poiID, const std::string& laneID, double lanePos, double lanePosLat);
 
+    /// @brief Returns whether a polygon with the given id has been added (and possibly written already)
+    bool hasPolygon(const std::string& id) const;
+
+    /** @brief Opens the given file and writes the shapes in batches while they are added
+     *
+     * The loaders call flushIfFull after each complete input feature, so the
+     *  stored shapes are written and deleted only when no parameters will be
+     *  added to them anymore. Only the ids of the written shapes are kept to
+     *  detect duplicates. The output is sorted by id only within each batch.
+     *
+     * @param[in] file The name of the file to write stored objects' definitions into
+     * @param[in] useGeo Whether to write output in geo-coordinates
+     * @param[in] batchSize The number of shapes to collect before writing them
+     * @exception IOError If the file could not be opened
+     */
+    void startStreaming(const std::string& file, bool useGeo, const int batchSize);
+
+    /** @brief Writes and deletes the stored shapes if streaming and the batch is full
+     *
+     * Must only be called when the loader does not refer to any of the stored shapes anymore.
+     */
+    void flushIfFull();
+
     /** @brief Saves the stored polygons and pois into the given file
+     *
+     * When streaming, the remaining shapes are written to the file given
+     *  to startStreaming and the file is closed.
+     *
      * @param[in] file The name of the file to write stored objects' definitions into
      * @param[in] useGeo Whether to write output in geo-coordinates
      * @exception IOError If the file could not be opened
@@ -138,6 +166,18 @@ private:
     /// @brief An id to int map for proper enumeration
     std::map<std::string, int> myIDEnums;
 
+    /// @brief The device written to while loading (0 if everything is written at the end)
+    OutputDevice* myStreamDevice;
+
+    /// @brief Whether the streamed output uses geo-coordinates
+    bool myStreamGeo;
+
+    /// @brief The number of shapes to collect before writing them
+    int myBatchSize;
+
+    /// @brief The ids of the shapes written already
+    std::set<std::string> myWrittenPolygons, myWrittenPOIs;
+
     /// @brief The boundary that described the rectangle within which an object must be in order to be kept
     Boundary myPruningBoundary;
 
@@ -149,6 +189,12 @@ private:
 
     static void writeDlrTDPHeader(OutputDevice& device, const OptionsCont& oc);
 
+    /// @brief writes the stored polygons and pois
+    void writeShapes(OutputDevice& out, bool useGeo) const;
+
+    /// @brief writes the stored shapes to the stream device and deletes them
+    void writeBatch();
+
 private:
     /// @brief Invalidated copy constructor
     PCPolyContainer(const PCPolyContainer& s);
@@ -55,6 +55,9 @@
 #include <polyconvert/PCTypeDefHandler.h>
 #include <polyconvert/PCNetProjectionLoader.h>
 #include "pc_typemap.h"
+#ifdef HAVE_FOX
+#include <utils/foxtools/MFXMutex.h>
+#endif
 
 
 // ===========================================================================
@@ -149,6 +152,9 @@ fillOptions() {
     oc.doRegister("dlr-tdp-output", new Option_FileName());
     oc.addDescription("dlr-tdp-output", "Output", "Write generated polygons/pois to a dlr-tdp file with the given prefix");
 
+    oc.doRegister("output.batch-size", new Option_Integer(0));
+    oc.addDescription("output.batch-size", "Output", "Write the polygons/pois in batches of INT elements while loading instead of keeping all of them in memory (the memory for the loaded input like OSM nodes and ways is not bounded)");
+
 
     // prunning options
     oc.doRegister("prune.in-net", new Option_Bool(false));
@@ -189,6 +195,9 @@ fillOptions() {
     oc.doRegister("poi-layer-offset", new Option_Float(0));
     oc.addDescription("poi-layer-offset", "Processing", "Adds FLOAT to the layer value for each poi (i.e. to raise it above polygons)");
 
+    oc.doRegister("threads", new Option_Integer(0));
+    oc.addDescription("threads", "Processing", "The number of parallel execution threads used for the type mapping and projection of OSM input");
+
     // building defaults options
     oc.doRegister("color", new Option_String("0.2,0.5,1."));
     oc.addDescription("color", "Building Defaults", "Sets STR as default color");
@@ -216,6 +225,11 @@ fillOptions() {
 
 int
 main(int argc, char** argv) {
+#ifdef HAVE_FOX
+    // make the output aware of threading
+    MFXMutex lock;
+    MsgHandler::assignLock(&lock);
+#endif
     OptionsCont& oc = OptionsCont::getOptions();
     oc.setApplicationDescription("Importer of polygons and POIs for the microscopic, multi-modal traffic simulation SUMO.");
     oc.setApplicationName("polyconvert", "Eclipse SUMO polyconvert Version " VERSION_STRING);
@@ -325,6 +339,27 @@ main(int argc, char** argv) {
             delete reader;
         }
         SystemFrame::checkOptions();
+        if (!oc.isSet("output-file") && !oc.isSet("dlr-tdp-output")) {
+            std::string out = "polygons.xml";
+            if (oc.isSet("configuration-file")) {
+                out = FileHelpers::getConfigurationRelative(oc.getString("configuration-file"), out);
+            }
+            oc.setDefault("output-file", out);
+        }
+        if (oc.getInt("threads") < 0) {
+            throw ProcessError("The number of threads must not be negative.");
+        }
+#ifndef HAVE_FOX
+        if (oc.getInt("threads") > 1) {
+            throw ProcessError("Parallel type mapping and projection is only possible when compiled with Fox.");
+        }
+#endif
+        if (oc.getInt("output.batch-size") > 0) {
+            if (oc.isSet("dlr-tdp-output")) {
+                throw ProcessError("The dlr-tdp-output cannot be written in batches.");
+            }
+            toFill.startStreaming(oc.getString("output-file"), oc.getBool("proj.plain-geo"), oc.getInt("output.batch-size"));
+        }
         // read in the data
         PCLoaderXML::loadIfSet(oc, toFill, tm); // SUMO-XML
         PCLoaderOSM::loadIfSet(oc, toFill, tm); // OSM-XML
@@ -337,13 +372,6 @@ main(int argc, char** argv) {
             throw ProcessError();
         }
         // output
-        if (!oc.isSet("output-file") && !oc.isSet("dlr-tdp-output")) {
-            std::string out = "polygons.xml";
-            if (oc.isSet("configuration-file")) {
-                out = FileHelpers::getConfigurationRelative(oc.getString("configuration-file"), out);
-            }
-            oc.setDefault("output-file", out);
-        }
         if (oc.isSet("output-file")) {
             toFill.save(oc.getString("output-file"), oc.getBool("proj.plain-geo"));
         }
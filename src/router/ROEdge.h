@@ -416,6 +416,21 @@ public:
     }
 
 
+    /** @brief Returns the minimum travel time of the given edge
+     *
+     * The value does not depend on the time and is a lower bound for the
+     *  travel times of all intervals loaded from weight files, so it is used
+     *  for computing admissible landmark distances for time dependent routing.
+     *
+     * @param[in] edge The edge for which the travel time shall be retrieved
+     * @param[in] veh The vehicle for which the travel time on this edge shall be retrieved
+     * @return The minimum traveltime needed by the given vehicle to pass the edge
+     */
+    static inline double getMinimumTravelTimeStatic(const ROEdge* const edge, const ROVehicle* const veh, double /* time */) {
+        return edge->getMinimumTravelTime(veh);
+    }
+
+
     template<PollutantsInterface::EmissionType ET>
     static double getEmissionEffort(const ROEdge* const edge, const ROVehicle* const veh, double time) {
         double ret = 0;
@@ -61,6 +61,8 @@ ROLoader::EdgeFloatTimeLineRetriever_EdgeTravelTime::addEdgeWeight(const std::st
     ROEdge* e = myNet.getEdge(id);
     if (e != 0) {
         e->addTravelTime(val, beg, end);
+        myBoundaries.insert(TIME2STEPS(beg));
+        myBoundaries.insert(TIME2STEPS(end));
     } else {
         if (id[0] != ':') {
             if (OptionsCont::getOptions().getBool("ignore-errors")) {
@@ -82,6 +84,8 @@ ROLoader::EdgeFloatTimeLineRetriever_EdgeWeight::addEdgeWeight(const std::string
     ROEdge* e = myNet.getEdge(id);
     if (e != 0) {
         e->addEffort(val, beg, end);
+        myBoundaries.insert(TIME2STEPS(beg));
+        myBoundaries.insert(TIME2STEPS(end));
     } else {
         if (id[0] != ':') {
             if (OptionsCont::getOptions().getBool("ignore-errors")) {
@@ -251,10 +255,10 @@ ROLoader::loadWeights(RONet& net, const std::string& optionName,
     // build and prepare the weights handler
     std::vector<SAXWeightsHandler::ToRetrieveDefinition*> retrieverDefs;
     //  travel time, first (always used)
-    EdgeFloatTimeLineRetriever_EdgeTravelTime ttRetriever(net);
+    EdgeFloatTimeLineRetriever_EdgeTravelTime ttRetriever(net, myWeightBoundaries);
     retrieverDefs.push_back(new SAXWeightsHandler::ToRetrieveDefinition("traveltime", !useLanes, ttRetriever));
     //  the measure to use, then
-    EdgeFloatTimeLineRetriever_EdgeWeight eRetriever(net);
+    EdgeFloatTimeLineRetriever_EdgeWeight eRetriever(net, myWeightBoundaries);
     if (measure != "traveltime") {
         std::string umeasure = measure;
         if (measure == "CO" || measure == "CO2" || measure == "HC" || measure == "PMx" || measure == "NOx" || measure == "fuel" || measure == "electricity") {
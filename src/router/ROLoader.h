@@ -26,6 +26,7 @@
 // ===========================================================================
 #include <config.h>
 
+#include <set>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/ValueTimeLine.h>
 #include <utils/xml/SAXWeightsHandler.h>
@@ -74,6 +75,11 @@ public:
     bool loadWeights(RONet& net, const std::string& optionName,
                      const std::string& measure, const bool useLanes, const bool boundariesOverride);
 
+    /// @brief Returns the begin and end times of all loaded weight intervals
+    const std::set<SUMOTime>& getWeightBoundaries() const {
+        return myWeightBoundaries;
+    }
+
     /** @brief Builds and opens all route loaders */
     void openRoutes(RONet& net);
 
@@ -114,7 +120,7 @@ protected:
     class EdgeFloatTimeLineRetriever_EdgeWeight : public SAXWeightsHandler::EdgeFloatTimeLineRetriever {
     public:
         /// @brief Constructor
-        EdgeFloatTimeLineRetriever_EdgeWeight(RONet& net) : myNet(net) {}
+        EdgeFloatTimeLineRetriever_EdgeWeight(RONet& net, std::set<SUMOTime>& boundaries) : myNet(net), myBoundaries(boundaries) {}
 
         /// @brief Destructor
         ~EdgeFloatTimeLineRetriever_EdgeWeight() { }
@@ -134,6 +140,9 @@ protected:
         /// @brief The network edges shall be obtained from
         RONet& myNet;
 
+        /// @brief The collected interval boundaries
+        std::set<SUMOTime>& myBoundaries;
+
     };
 
 
@@ -145,7 +154,7 @@ protected:
     class EdgeFloatTimeLineRetriever_EdgeTravelTime : public SAXWeightsHandler::EdgeFloatTimeLineRetriever {
     public:
         /// @brief Constructor
-        EdgeFloatTimeLineRetriever_EdgeTravelTime(RONet& net) : myNet(net) {}
+        EdgeFloatTimeLineRetriever_EdgeTravelTime(RONet& net, std::set<SUMOTime>& boundaries) : myNet(net), myBoundaries(boundaries) {}
 
         /// @brief Destructor
         ~EdgeFloatTimeLineRetriever_EdgeTravelTime() {}
@@ -165,6 +174,9 @@ protected:
         /// @brief The network edges shall be obtained from
         RONet& myNet;
 
+        /// @brief The collected interval boundaries
+        std::set<SUMOTime>& myBoundaries;
+
     };
 
 
@@ -186,6 +198,9 @@ private:
     /// @brief List of route loaders
     SUMORouteLoaderControl myLoaders;
 
+    /// @brief The begin and end times of the loaded weight intervals
+    std::set<SUMOTime> myWeightBoundaries;
+
 
 private:
     /// @brief Invalidated copy constructor
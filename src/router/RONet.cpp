@@ -41,6 +41,9 @@
 #include "ROVehicle.h"
 #include "RONet.h"
 
+// the number of routed but unwritten routables (per thread) before writing starts
+#define MAX_PENDING_ROUTES_PER_THREAD 100
+
 
 // ===========================================================================
 // static member definitions
@@ -355,6 +358,7 @@ bool
 RONet::addVehicle(const std::string& id, ROVehicle* veh) {
     if (myVehIDs.find(id) == myVehIDs.end()) {
         myVehIDs.insert(id);
+        myReadRouteNo++;
         if (veh->isPublicTransport()) {
             if (!veh->isPartOfFlow()) {
                 myPTVehicles.push_back(veh);
@@ -549,6 +553,12 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
 #endif
             createBulkRouteRequests(provider, time, removeLoops);
         } else {
+#ifdef HAVE_FOX
+            // the number of unfinished routing tasks per departure time, routables are written
+            //  in departure order as soon as all routables departing before them are finished
+            std::map<SUMOTime, int> pending;
+            int numPending = 0;
+#endif
             for (RoutablesMap::const_iterator i = myRoutables.begin(); i != myRoutables.end(); ++i) {
                 if (i->first >= time) {
                     break;
@@ -569,6 +579,16 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
                                 new WorkerThread(myThreadPool, provider);
                             }
                             myThreadPool.add(new RoutingTask(routable, removeLoops, myErrorHandler));
+                            pending[i->first]++;
+                            numPending++;
+                            // bound the number of routed but unwritten routables
+                            if (numPending >= MAX_PENDING_ROUTES_PER_THREAD * maxNumThreads) {
+                                writeFinishedRoutes(options, pending, i->first, lastTime);
+                                numPending = 0;
+                                for (std::map<SUMOTime, int>::const_iterator p = pending.begin(); p != pending.end(); ++p) {
+                                    numPending += p->second;
+                                }
+                            }
                         }
                         continue;
                     }
@@ -581,6 +601,28 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
         myThreadPool.waitAll();
 #endif
     }
+    return writeAndRemoveRoutesUntil(options, time, lastTime);
+}
+
+
+#ifdef HAVE_FOX
+void
+RONet::writeFinishedRoutes(OptionsCont& options, std::map<SUMOTime, int>& pending, const SUMOTime time, SUMOTime& lastTime) {
+    for (FXWorkerThread::Task* const task : myThreadPool.getFinished()) {
+        std::map<SUMOTime, int>::iterator p = pending.find(static_cast<RoutingTask*>(task)->getRoutable()->getDepart());
+        if (--p->second == 0) {
+            pending.erase(p);
+        }
+        delete task;
+    }
+    writeAndRemoveRoutesUntil(options, pending.empty() ? time : MIN2(time, pending.begin()->first), lastTime);
+}
+#endif
+
+
+SUMOTime
+RONet::writeAndRemoveRoutesUntil(OptionsCont& options, const SUMOTime time, SUMOTime& lastTime) {
+    const bool forgetIDs = options.exists("forget-written-ids") && options.getBool("forget-written-ids");
     // write all vehicles (and additional structures)
     while (myRoutables.size() != 0 || myContainers.size() != 0) {
         // get the next vehicle, person or container
@@ -590,8 +632,7 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
         const SUMOTime containerTime = container == myContainers.end() ? SUMOTime_MAX : container->first;
         // check whether it shall not yet be computed
         if (routableTime >= time && containerTime >= time) {
-            lastTime = MIN2(routableTime, containerTime);
-            break;
+            return MIN2(routableTime, containerTime);
         }
         const SUMOTime minTime = MIN2(routableTime, containerTime);
         if (routableTime == minTime) {
@@ -599,7 +640,7 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
             if (lastTime != routableTime && lastTime != -1) {
                 // report writing progress
                 if (options.getInt("stats-period") >= 0 && ((int)routableTime % options.getInt("stats-period")) == 0) {
-                    WRITE_MESSAGE("Read: " + toString(myVehIDs.size()) + ",  Discarded: " + toString(myDiscardedRouteNo) + ",  Written: " + toString(myWrittenRouteNo));
+                    WRITE_MESSAGE("Read: " + toString(myReadRouteNo) + ",  Discarded: " + toString(myDiscardedRouteNo) + ",  Written: " + toString(myWrittenRouteNo));
                 }
             }
             lastTime = routableTime;
@@ -620,6 +661,13 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, const RORouterProvider& pr
                             delete veh->getRouteDefinition();
                         }
                     }
+                    if (forgetIDs) {
+                        if (veh != 0) {
+                            myVehIDs.erase(r->getID());
+                        } else {
+                            myPersonIDs.erase(r->getID());
+                        }
+                    }
                     delete r;
                 }
             }
@@ -697,6 +745,119 @@ RONet::setPermissionsFound() {
     myHavePermissions = true;
 }
 
+
+bool
+RONet::mayReach(const ROEdge* const from, const ROEdge* const to, const SUMOVehicleClass vClass) {
+    const Components* components;
+    {
+#ifdef HAVE_FOX
+        FXMutexLock locker(myComponentsLock);
+#endif
+        std::map<SUMOVehicleClass, Components>::iterator it = myComponents.find(vClass);
+        if (it == myComponents.end()) {
+            it = myComponents.insert(std::make_pair(vClass, Components())).first;
+            computeComponents(vClass, it->second);
+        }
+        components = &it->second;
+    }
+    const int fromIndex = from->getNumericalID();
+    const int toIndex = to->getNumericalID();
+    if (fromIndex >= (int)components->strong.size() || toIndex >= (int)components->strong.size() ||
+            components->strong[fromIndex] < 0 || components->strong[toIndex] < 0) {
+        return true;
+    }
+    // there are no edges from a component to one with a higher number
+    return components->weak[fromIndex] == components->weak[toIndex] && components->strong[fromIndex] >= components->strong[toIndex];
+}
+
+
+void
+RONet::computeComponents(const SUMOVehicleClass vClass, Components& into) {
+    const ROEdgeVector& edges = ROEdge::getAllEdges();
+    const int numEdges = (int)edges.size();
+    std::vector<bool> allowed(numEdges, false);
+    for (int i = 0; i < numEdges; i++) {
+        allowed[i] = edges[i] != nullptr && (edges[i]->getPermissions() & vClass) == vClass;
+    }
+    into.strong.assign(numEdges, -1);
+    into.weak.assign(numEdges, -1);
+    // union find for the weakly connected components
+    std::vector<int> parent(numEdges);
+    for (int i = 0; i < numEdges; i++) {
+        parent[i] = i;
+    }
+    // iterative version of Tarjan's algorithm for the strongly connected components
+    std::vector<int> index(numEdges, -1);
+    std::vector<int> lowLink(numEdges, -1);
+    std::vector<bool> onStack(numEdges, false);
+    std::vector<int> stack;
+    std::vector<std::pair<int, int> > callStack;
+    int nextIndex = 0;
+    int numComponents = 0;
+    for (int start = 0; start < numEdges; start++) {
+        if (!allowed[start] || index[start] >= 0) {
+            continue;
+        }
+        index[start] = lowLink[start] = nextIndex++;
+        stack.push_back(start);
+        onStack[start] = true;
+        callStack.push_back(std::make_pair(start, 0));
+        while (!callStack.empty()) {
+            const int v = callStack.back().first;
+            const ROEdgeVector& successors = edges[v]->getSuccessors(vClass);
+            if (callStack.back().second < (int)successors.size()) {
+                const int w = successors[callStack.back().second++]->getNumericalID();
+                if (!allowed[w]) {
+                    continue;
+                }
+                // unite the weak components
+                int rootV = v;
+                while (parent[rootV] != rootV) {
+                    rootV = parent[rootV] = parent[parent[rootV]];
+                }
+                int rootW = w;
+                while (parent[rootW] != rootW) {
+                    rootW = parent[rootW] = parent[parent[rootW]];
+                }
+                parent[MAX2(rootV, rootW)] = MIN2(rootV, rootW);
+                if (index[w] < 0) {
+                    index[w] = lowLink[w] = nextIndex++;
+                    stack.push_back(w);
+                    onStack[w] = true;
+                    callStack.push_back(std::make_pair(w, 0));
+                } else if (onStack[w]) {
+                    lowLink[v] = MIN2(lowLink[v], index[w]);
+                }
+            } else {
+                callStack.pop_back();
+                if (!callStack.empty()) {
+                    const int u = callStack.back().first;
+                    lowLink[u] = MIN2(lowLink[u], lowLink[v]);
+                }
+                if (lowLink[v] == index[v]) {
+                    int w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        onStack[w] = false;
+                        into.strong[w] = numComponents;
+                    } while (w != v);
+                    numComponents++;
+                }
+            }
+        }
+    }
+    for (int i = 0; i < numEdges; i++) {
+        if (allowed[i]) {
+            int root = i;
+            while (parent[root] != root) {
+                root = parent[root];
+            }
+            into.weak[i] = root;
+        }
+    }
+}
+
 const std::string
 RONet::getStoppingPlaceName(const std::string& id) const {
     for (const auto& mapItem : myStoppingPlaces) {
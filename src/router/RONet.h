@@ -404,6 +404,21 @@ public:
 
     void setPermissionsFound();
 
+    /** @brief Returns whether the destination may be reachable from the origin for the given vehicle class
+     *
+     * On the first call for a vehicle class the strongly and weakly connected
+     *  components of the network restricted to this class are computed. Afterwards
+     *  the check takes constant time. A return value of false means that no route
+     *  exists, true means that the components do not exclude one (or that one of
+     *  the edges is prohibited for the class and the router has to decide).
+     *
+     * @param[in] from The origin edge
+     * @param[in] to The destination edge
+     * @param[in] vClass The vehicle class to check
+     * @return Whether a route may exist
+     */
+    bool mayReach(const ROEdge* const from, const ROEdge* const to, const SUMOVehicleClass vClass);
+
     OutputDevice* getRouteOutput(const bool alternative = false) {
         if (alternative) {
             return myRouteAlternativesOutput;
@@ -446,6 +461,27 @@ private:
 
     void createBulkRouteRequests(const RORouterProvider& provider, const SUMOTime time, const bool removeLoops);
 
+    /** @brief Writes and removes the stored vehicles, persons and containers departing before the given time
+     *
+     * All routables departing before the given time need to be routed already.
+     * @param[in] options The options used during this process
+     * @param[in] time The time until which route definitions shall be written
+     * @param[in, out] lastTime The last written departure time (-1 if nothing was written)
+     * @return The last seen departure time
+     */
+    SUMOTime writeAndRemoveRoutesUntil(OptionsCont& options, const SUMOTime time, SUMOTime& lastTime);
+
+#ifdef HAVE_FOX
+    /** @brief Collects the finished routing tasks and writes the routables which precede all unfinished ones
+     *
+     * @param[in] options The options used during this process
+     * @param[in] pending The number of unfinished routing tasks per departure time
+     * @param[in] time The departure time of the first routable which has not been added to the pool yet
+     * @param[in, out] lastTime The last written departure time (-1 if nothing was written)
+     */
+    void writeFinishedRoutes(OptionsCont& options, std::map<SUMOTime, int>& pending, const SUMOTime time, SUMOTime& lastTime);
+#endif
+
 private:
     /// @brief Unique instance of RONet
     static RONet* myInstance;
@@ -540,6 +576,28 @@ private:
     /// @brief whether to keep the the vtype distribution in output
     const bool myKeepVTypeDist;
 
+    /**
+     * @struct Components
+     * @brief The connected components of the network restricted to a single vehicle class
+     */
+    struct Components {
+        /// @brief the strongly connected component of each edge (-1 for prohibited edges) in reverse topological order
+        std::vector<int> strong;
+        /// @brief the weakly connected component of each edge (-1 for prohibited edges)
+        std::vector<int> weak;
+    };
+
+    /// @brief The connected components for each vehicle class requested so far
+    std::map<SUMOVehicleClass, Components> myComponents;
+
+#ifdef HAVE_FOX
+    /// @brief The mutex guarding the lazy computation of the components
+    FXMutex myComponentsLock;
+#endif
+
+    /// @brief computes the connected components of the network restricted to the given vehicle class
+    static void computeComponents(const SUMOVehicleClass vClass, Components& into);
+
 #ifdef HAVE_FOX
 private:
     class RoutingTask : public FXWorkerThread::Task {
@@ -547,6 +605,9 @@ private:
         RoutingTask(RORoutable* v, const bool removeLoops, MsgHandler* errorHandler)
             : myRoutable(v), myRemoveLoops(removeLoops), myErrorHandler(errorHandler) {}
         void run(FXWorkerThread* context);
+        const RORoutable* getRoutable() const {
+            return myRoutable;
+        }
     private:
         RORoutable* const myRoutable;
         const bool myRemoveLoops;
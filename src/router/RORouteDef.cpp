@@ -39,6 +39,7 @@
 #include <utils/vehicle/SUMOAbstractRouter.h>
 #include <utils/vehicle/RouteCostCalculator.h>
 #include "RORouteDef.h"
+#include "RONet.h"
 #include "ROVehicle.h"
 
 // ===========================================================================
@@ -230,14 +231,14 @@ RORouteDef::repairCurrentRoute(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
                 }
                 const ROEdge* const last = newEdges.back();
                 newEdges.pop_back();
-                if (!router.compute(last, *i, &veh, begin, newEdges)) {
+                if (!computeRoute(router, last, *i, veh, begin, newEdges, mh)) {
                     // backtrack: try to route from last mandatory edge to next mandatory edge
                     // XXX add option for backtracking in smaller increments
                     // (i.e. previous edge to edge after *i)
                     // we would then need to decide whether we have found a good
                     // tradeoff between faithfulness to the input data and detour-length
                     ConstROEdgeVector edges;
-                    if (lastMandatory >= (int)newEdges.size() || last == newEdges[lastMandatory] || !router.compute(newEdges[lastMandatory], *nextMandatory, &veh, begin, edges)) {
+                    if (lastMandatory >= (int)newEdges.size() || last == newEdges[lastMandatory] || !computeRoute(router, newEdges[lastMandatory], *nextMandatory, veh, begin, edges, mh)) {
                         mh->inform("Mandatory edge '" + (*i)->getID() + "' not reachable by vehicle '" + veh.getID() + "'.");
                         return false;
                     }
@@ -258,6 +259,19 @@ RORouteDef::repairCurrentRoute(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
 }
 
 
+bool
+RORouteDef::computeRoute(SUMOAbstractRouter<ROEdge, ROVehicle>& router, const ROEdge* const from, const ROEdge* const to,
+                         const ROVehicle& veh, SUMOTime begin, ConstROEdgeVector& into, MsgHandler* mh) const {
+    // the routers of jtrrouter do not search for shortest paths, so we leave them alone
+    if (!myUsingJTRR && !RONet::getInstance()->mayReach(from, to, veh.getVClass())) {
+        // this is the message the router would have given after exploring the whole component
+        mh->inform("No connection between edge '" + from->getID() + "' and edge '" + to->getID() + "' found.");
+        return false;
+    }
+    return router.compute(from, to, &veh, begin, into);
+}
+
+
 void
 RORouteDef::addAlternative(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
                            const ROVehicle* const veh, RORoute* current, SUMOTime begin) {
@@ -35,6 +35,7 @@
 // ===========================================================================
 // class declarations
 // ===========================================================================
+class MsgHandler;
 class ROEdge;
 class OptionsCont;
 class ROVehicle;
@@ -90,6 +91,14 @@ public:
     bool repairCurrentRoute(SUMOAbstractRouter<ROEdge, ROVehicle>& router, SUMOTime begin,
                             const ROVehicle& veh, ConstROEdgeVector oldEdges, ConstROEdgeVector& newEdges) const;
 
+    /** @brief Computes a route between the given edges
+     *
+     * The router is not called if the connected components of the network
+     *  show that the destination cannot be reached by the vehicle.
+     */
+    bool computeRoute(SUMOAbstractRouter<ROEdge, ROVehicle>& router, const ROEdge* const from, const ROEdge* const to,
+                      const ROVehicle& veh, SUMOTime begin, ConstROEdgeVector& into, MsgHandler* mh) const;
+
     /** @brief Adds an alternative to the list of routes
     *
      * (This may be the new route) */
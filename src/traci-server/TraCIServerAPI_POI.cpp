@@ -236,7 +236,7 @@ TraCIServerAPI_POI::getPosition(const std::string& id, Position& p) {
 
 PointOfInterest*
 TraCIServerAPI_POI::getPoI(const std::string& id) {
-    return MSNet::getInstance()->getShapeContainer().getPOIs().get(id);
+    return MSNet::getInstance()->getShapeContainer().getPOI(id);
 }
 
 
@@ -249,7 +249,7 @@ TraCIServerAPI_Polygon::getShape(const std::string& id, PositionVector& shape) {
 
 SUMOPolygon*
 TraCIServerAPI_Polygon::getPolygon(const std::string& id) {
-    return MSNet::getInstance()->getShapeContainer().getPolygons().get(id);
+    return MSNet::getInstance()->getShapeContainer().getPolygon(id);
 }
 
 
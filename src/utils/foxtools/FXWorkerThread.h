@@ -164,6 +164,25 @@ public:
             myMutex.unlock();
         }
 
+        /** @brief Waits until at least one task is finished and returns the finished tasks
+         *
+         * The returned tasks are removed from the list of finished tasks and have to be deleted by the caller.
+         *  This allows processing results while other tasks are still running. If no task is pending
+         *  the (possibly empty) list is returned immediately.
+         *
+         * @return the tasks finished since the last call
+         */
+        std::list<Task*> getFinished() {
+            std::list<Task*> result;
+            myMutex.lock();
+            while (myFinishedTasks.empty() && myNumFinished < myRunningIndex) {
+                myCondition.wait(myMutex);
+            }
+            result.swap(myFinishedTasks);
+            myMutex.unlock();
+            return result;
+        }
+
         /** @brief Checks whether there are currently more pending tasks than threads.
          *
          * This is only a rough estimate because the tasks are already assigned and there could be an idle thread even though the
@@ -55,6 +55,7 @@ GeoConvHelper::GeoConvHelper(const std::string& proj, const Position& offset,
     myProjection(0),
     myInverseProjection(0),
     myGeoProjection(0),
+    myLatLongProjection(0),
 #endif
     myOffset(offset),
     myGeoScale(scale),
@@ -82,6 +83,7 @@ GeoConvHelper::GeoConvHelper(const std::string& proj, const Position& offset,
             // !!! check pj_errno
             throw ProcessError("Could not build projection!");
         }
+        myLatLongProjection = pj_latlong_from_proj(myProjection);
 #endif
     }
 }
@@ -98,6 +100,9 @@ GeoConvHelper::~GeoConvHelper() {
     if (myGeoProjection != 0) {
         pj_free(myInverseProjection);
     }
+    if (myLatLongProjection != 0) {
+        pj_free(myLatLongProjection);
+    }
 #endif
 }
 
@@ -140,8 +145,13 @@ GeoConvHelper::operator=(const GeoConvHelper& orig) {
         pj_free(myGeoProjection);
         myGeoProjection = 0;
     }
+    if (myLatLongProjection != 0) {
+        pj_free(myLatLongProjection);
+        myLatLongProjection = 0;
+    }
     if (orig.myProjection != 0) {
         myProjection = pj_init_plus(orig.myProjString.c_str());
+        myLatLongProjection = pj_latlong_from_proj(myProjection);
     }
     if (orig.myInverseProjection != 0) {
         myInverseProjection = pj_init_plus(pj_get_def(orig.myInverseProjection, 0));
@@ -234,6 +244,171 @@ GeoConvHelper::addProjectionOptions(OptionsCont& oc) {
 }
 
 
+void
+GeoConvHelper::cartesian2geo(PositionVector& cartesian) const {
+#ifdef HAVE_PROJ
+    if (myProjectionMethod != NONE && myProjectionMethod != SIMPLE) {
+        const Position offset = getOffsetBase();
+        std::vector<double> x, y;
+        x.reserve(cartesian.size());
+        y.reserve(cartesian.size());
+        for (PositionVector::iterator i = cartesian.begin(); i != cartesian.end(); ++i) {
+            i->sub(offset);
+            x.push_back(i->x());
+            y.push_back(i->y());
+        }
+        projectBatch(x, y, true);
+        for (int i = 0; i < (int)cartesian.size(); i++) {
+            cartesian[i].set(x[i] * RAD_TO_DEG, y[i] * RAD_TO_DEG);
+        }
+        return;
+    }
+#endif
+    for (PositionVector::iterator i = cartesian.begin(); i != cartesian.end(); ++i) {
+        cartesian2geo(*i);
+    }
+}
+
+
+bool
+GeoConvHelper::x2cartesian(PositionVector& from, bool includeInBoundary) {
+    if (from.size() == 0) {
+        return true;
+    }
+    // the first position initializes the projection if needed
+    bool ok = x2cartesian(from[0], includeInBoundary);
+    int begin = 1;
+#ifdef HAVE_PROJ
+    // the initialisation fails for invalid positions and is retried with the next ones
+    while (begin < (int)from.size() && myProjection == 0 && myProjectionMethod != NONE && myProjectionMethod != SIMPLE) {
+        ok &= x2cartesian(from[begin++], includeInBoundary);
+    }
+    if (myInverseProjection != 0) {
+        // datum shifts are only done position-wise
+        for (int i = begin; i < (int)from.size(); i++) {
+            ok &= x2cartesian(from[i], includeInBoundary);
+        }
+        return ok;
+    }
+#endif
+    if (includeInBoundary) {
+        for (int i = begin; i < (int)from.size(); i++) {
+            myOrigBoundary.add(from[i]);
+        }
+    }
+    return x2cartesianRange(from, begin, includeInBoundary ? &myConvBoundary : 0) && ok;
+}
+
+
+bool
+GeoConvHelper::x2cartesian_const(PositionVector& from) const {
+    return x2cartesianRange(from, 0, 0);
+}
+
+
+bool
+GeoConvHelper::x2cartesianRange(PositionVector& from, const int begin, Boundary* const convBoundary) const {
+    bool ok = true;
+    if (myProjectionMethod == NONE || myUseInverseProjection) {
+        for (int i = begin; i < (int)from.size(); i++) {
+            if (x2cartesian_const(from[i])) {
+                if (convBoundary != 0) {
+                    convBoundary->add(from[i]);
+                }
+            } else {
+                ok = false;
+            }
+        }
+        return ok;
+    }
+    // rotate and scale, keeping the valid geo-coordinates only
+    std::vector<int> index;
+    std::vector<double> x, y;
+    index.reserve(from.size());
+    x.reserve(from.size());
+    y.reserve(from.size());
+    for (int i = begin; i < (int)from.size(); i++) {
+        const double x2 = from[i].x() * myGeoScale;
+        const double y2 = from[i].y() * myGeoScale;
+        const double lon = x2 * myCos - y2 * mySin;
+        const double lat = x2 * mySin + y2 * myCos;
+        if (lon > 180.1 || lon < -180.1) {
+            WRITE_WARNING("Invalid longitude " + toString(lon));
+            ok = false;
+            continue;
+        }
+        if (lat > 90.1 || lat < -90.1) {
+            WRITE_WARNING("Invalid latitude " + toString(lat));
+            ok = false;
+            continue;
+        }
+        index.push_back(i);
+        x.push_back(lon);
+        y.push_back(lat);
+    }
+    const int numValid = (int)index.size();
+#ifdef HAVE_PROJ
+    if (myProjection != 0) {
+        for (int i = 0; i < numValid; i++) {
+            x[i] *= DEG_TO_RAD;
+            y[i] *= DEG_TO_RAD;
+        }
+        projectBatch(x, y, false);
+    }
+#endif
+    if (myProjectionMethod == SIMPLE) {
+        for (int i = 0; i < numValid; i++) {
+            x[i] *= 111320. * cos(DEG2RAD(y[i]));
+            y[i] *= 111136.;
+        }
+    }
+    for (int i = 0; i < numValid; i++) {
+        if (x[i] > std::numeric_limits<double>::max() ||
+                y[i] > std::numeric_limits<double>::max()) {
+            ok = false;
+            continue;
+        }
+        Position& pos = from[index[i]];
+        pos.set(x[i], y[i]);
+        pos.add(myOffset);
+        if (convBoundary != 0) {
+            convBoundary->add(pos);
+        }
+    }
+    return ok;
+}
+
+
+#ifdef HAVE_PROJ
+void
+GeoConvHelper::projectBatch(std::vector<double>& x, std::vector<double>& y, const bool inverse) const {
+    if (x.empty()) {
+        return;
+    }
+    if (myLatLongProjection != 0) {
+        std::vector<double> tx(x);
+        std::vector<double> ty(y);
+        const int error = inverse ? pj_transform(myProjection, myLatLongProjection, (long)x.size(), 1, &tx[0], &ty[0], 0)
+                          : pj_transform(myLatLongProjection, myProjection, (long)x.size(), 1, &tx[0], &ty[0], 0);
+        if (error == 0) {
+            x.swap(tx);
+            y.swap(ty);
+            return;
+        }
+    }
+    for (int i = 0; i < (int)x.size(); i++) {
+        projUV p;
+        p.u = x[i];
+        p.v = y[i];
+        p = inverse ? pj_inv(p, myProjection) : pj_fwd(p, myProjection);
+        //!!! check pj_errno
+        x[i] = p.u;
+        y[i] = p.v;
+    }
+}
+#endif
+
+
 bool
 GeoConvHelper::usingGeoProjection() const {
     return myProjectionMethod != NONE;
@@ -319,6 +494,9 @@ GeoConvHelper::x2cartesian(Position& from, bool includeInBoundary) {
             default:
                 break;
         }
+        if (myProjection != 0) {
+            myLatLongProjection = pj_latlong_from_proj(myProjection);
+        }
     }
     if (myInverseProjection != 0) {
         double x = from.x();
@@ -393,6 +571,18 @@ GeoConvHelper::moveConvertedBy(double x, double y) {
 }
 
 
+void
+GeoConvHelper::includeBoundaries(const GeoConvHelper& other) {
+    // uninitialised boundaries have their minimum above their maximum
+    if (other.myOrigBoundary.xmin() <= other.myOrigBoundary.xmax()) {
+        myOrigBoundary.add(other.myOrigBoundary);
+    }
+    if (other.myConvBoundary.xmin() <= other.myConvBoundary.xmax()) {
+        myConvBoundary.add(other.myConvBoundary);
+    }
+}
+
+
 const Boundary&
 GeoConvHelper::getOrigBoundary() const {
     return myOrigBoundary;
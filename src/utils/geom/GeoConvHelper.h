@@ -27,8 +27,10 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include <utils/geom/Position.h>
 #include <utils/geom/Boundary.h>
+#include <utils/geom/PositionVector.h>
 
 #ifdef HAVE_PROJ
 #include <proj_api.h>
@@ -121,6 +123,20 @@ public:
     /// @brief Converts the given coordinate into a cartesian using the previous initialisation
     bool x2cartesian_const(Position& from) const;
 
+    /// @brief Converts all given cartesian (shifted) positions to their geo (lat/long) representation
+    void cartesian2geo(PositionVector& cartesian) const;
+
+    /**@brief Converts all given coordinates into cartesians and optionally update myConvBoundary
+     *
+     * Gives the same results as converting the positions one by one but
+     *  hands all positions to the proj library in a single call.
+     * @return Whether all positions could be converted
+     */
+    bool x2cartesian(PositionVector& from, bool includeInBoundary = true);
+
+    /// @brief Converts all given coordinates into cartesians using the previous initialisation
+    bool x2cartesian_const(PositionVector& from) const;
+
     /// @brief Returns whether a transformation from geo to metric coordinates will be performed
     bool usingGeoProjection() const;
 
@@ -130,6 +146,11 @@ public:
     /// @brief Shifts the converted boundary by the given amounts
     void moveConvertedBy(double x, double y);
 
+    /** @brief Extends the original and the converted boundary by those of the given transformation
+     * @note Used for collecting the boundaries of copies which converted positions in other threads
+     */
+    void includeBoundaries(const GeoConvHelper& other);
+
     /// @brief Returns the original boundary
     const Boundary& getOrigBoundary() const;
 
@@ -153,6 +174,11 @@ public:
     /// @brief @brief writes the location element
     static void writeLocation(OutputDevice& into);
 
+    /** @brief Copies the transformation including the boundaries
+     * @note The copy builds its own proj objects, so it can be used in another thread than the original
+     */
+    GeoConvHelper& operator=(const GeoConvHelper&);
+
     bool operator==(const GeoConvHelper& o) const;
 
     bool operator!=(const GeoConvHelper& o) const {
@@ -160,6 +186,25 @@ public:
     }
 
 private:
+    /** @brief Converts the positions starting at the given index using the previous initialisation
+     * @param[in, out] from The positions to convert
+     * @param[in] begin The index of the first position to convert
+     * @param[in, out] convBoundary The boundary to add the converted positions to (if not 0)
+     * @return Whether all positions could be converted
+     */
+    bool x2cartesianRange(PositionVector& from, const int begin, Boundary* const convBoundary) const;
+
+#ifdef HAVE_PROJ
+    /** @brief Transforms between geo-coordinates (in radians) and the projection using a single call of the proj library
+     *
+     * Falls back to the point-wise transformation if the proj library rejects the batch.
+     * @param[in, out] x The x-coordinates (longitudes) to transform
+     * @param[in, out] y The y-coordinates (latitudes) to transform
+     * @param[in] inverse Whether projected coordinates shall be transformed to geo-coordinates
+     */
+    void projectBatch(std::vector<double>& x, std::vector<double>& y, const bool inverse) const;
+#endif
+
     /// @brief projection method
     enum ProjectionMethod {
         NONE,
@@ -182,6 +227,9 @@ private:
 
     /// @brief The geo proj.4-projection which is the target of the inverse projection
     projPJ myGeoProjection;
+
+    /// @brief The lat/long system of myProjection used for transforming whole geometries
+    projPJ myLatLongProjection;
 #endif
 
     /// @brief The offset to apply
@@ -218,9 +266,6 @@ private:
     /// @brief the numer of coordinate transformations loaded from location elements
     static int myNumLoaded;
 
-    /// @brief make assignment operator private
-    GeoConvHelper& operator=(const GeoConvHelper&);
-
     /// @brief invalidated copy constructor.
     GeoConvHelper(const GeoConvHelper&) = delete;
 };
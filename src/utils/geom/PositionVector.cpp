@@ -128,9 +128,12 @@ PositionVector::overlapsWith(const AbstractPoly& poly, double offset) const {
 double
 PositionVector::getOverlapWith(const PositionVector& poly, double zThreshold) const {
     double result = 0;
+    // the (cheap) bounding box tests skip the angle summation in around for most points
+    const Boundary polyBox = poly.getBoxBoundary();
+    const Boundary box = getBoxBoundary();
     // this points within poly
     for (const_iterator i = begin(); i != end() - 1; i++) {
-        if (poly.around(*i)) {
+        if (within2D(*i, polyBox) && poly.around(*i)) {
             Position closest = poly.positionAtOffset2D(poly.nearest_offset_to_point2D(*i));
             if (fabs(closest.z() - (*i).z()) < zThreshold) {
                 result = MAX2(result, poly.distance2D(*i));
@@ -139,7 +142,7 @@ PositionVector::getOverlapWith(const PositionVector& poly, double zThreshold) co
     }
     // polys points within this
     for (const_iterator i = poly.begin(); i != poly.end() - 1; i++) {
-        if (around(*i)) {
+        if (within2D(*i, box) && around(*i)) {
             Position closest = positionAtOffset2D(nearest_offset_to_point2D(*i));
             if (fabs(closest.z() - (*i).z()) < zThreshold) {
                 result = MAX2(result, distance2D(*i));
@@ -730,32 +733,50 @@ PositionVector::beginEndAngle() const {
 
 double
 PositionVector::nearest_offset_to_point2D(const Position& p, bool perpendicular) const {
+    // this inlines GeomHelper::nearest_offset_on_line_to_point2D and positionAtOffset2D
+    // reusing the segment length (all three computed it separately) without changing the result
     double minDist = std::numeric_limits<double>::max();
     double nearestPos = GeomHelper::INVALID_OFFSET;
     double seen = 0;
-    for (const_iterator i = begin(); i != end() - 1; i++) {
-        const double pos =
-            GeomHelper::nearest_offset_on_line_to_point2D(*i, *(i + 1), p, perpendicular);
-        const double dist = pos == GeomHelper::INVALID_OFFSET ? minDist : p.distanceTo2D(positionAtOffset2D(*i, *(i + 1), pos));
-        if (dist < minDist) {
-            nearestPos = pos + seen;
-            minDist = dist;
+    double prevLength = 0;
+    const const_iterator last = end() - 1;
+    for (const_iterator i = begin(); i != last; i++) {
+        const Position& p1 = *i;
+        const Position& p2 = *(i + 1);
+        const double dx = p2.x() - p1.x();
+        const double dy = p2.y() - p1.y();
+        const double length = p1.distanceTo2D(p2);
+        double pos = 0.;
+        if (length != 0.) {
+            const double u = ((p.x() - p1.x()) * dx + (p.y() - p1.y()) * dy) / (length * length);
+            if (u < 0. || u > 1.) {
+                pos = perpendicular ? GeomHelper::INVALID_OFFSET : (u < 0. ? 0. : length);
+            } else {
+                pos = u * length;
+            }
         }
-        if (perpendicular && i != begin() && pos == GeomHelper::INVALID_OFFSET) {
+        if (pos != GeomHelper::INVALID_OFFSET) {
+            const double dist = pos == 0. ? p.distanceTo2D(p1) : p.distanceTo2D(Position(p1.x() + dx * (pos / length), p1.y() + dy * (pos / length)));
+            if (dist < minDist) {
+                nearestPos = pos + seen;
+                minDist = dist;
+            }
+        } else if (i != begin()) {
             // even if perpendicular is set we still need to check the distance to the inner points
-            const double cornerDist = p.distanceTo2D(*i);
+            const double cornerDist = p.distanceTo2D(p1);
             if (cornerDist < minDist) {
                 const double pos1 =
-                    GeomHelper::nearest_offset_on_line_to_point2D(*(i - 1), *i, p, false);
+                    GeomHelper::nearest_offset_on_line_to_point2D(*(i - 1), p1, p, false);
                 const double pos2 =
-                    GeomHelper::nearest_offset_on_line_to_point2D(*i, *(i + 1), p, false);
-                if (pos1 == (*(i - 1)).distanceTo2D(*i) && pos2 == 0.) {
+                    GeomHelper::nearest_offset_on_line_to_point2D(p1, p2, p, false);
+                if (pos1 == prevLength && pos2 == 0.) {
                     nearestPos = seen;
                     minDist = cornerDist;
                 }
             }
         }
-        seen += (*i).distanceTo2D(*(i + 1));
+        seen += length;
+        prevLength = length;
     }
     return nearestPos;
 }
@@ -1246,6 +1267,12 @@ PositionVector::intersects(const Position& p11, const Position& p12, const Posit
 }
 
 
+bool
+PositionVector::within2D(const Position& p, const Boundary& box) {
+    return p.x() >= box.xmin() && p.x() <= box.xmax() && p.y() >= box.ymin() && p.y() <= box.ymax();
+}
+
+
 void
 PositionVector::rotate2D(double angle) {
     const double s = sin(angle);
@@ -388,6 +388,9 @@ public:
 private:
     /// @brief return whether the line segments defined by Line p11,p12 and Line p21,p22 intersect
     static bool intersects(const Position& p11, const Position& p12, const Position& p21, const Position& p22, const double withinDist = 0., double* x = 0, double* y = 0, double* mu = 0);
+
+    /// @brief return whether the given point lies within the 2D projection of the boundary
+    static bool within2D(const Position& p, const Boundary& box);
 };
 
 
@@ -31,6 +31,7 @@
 #include <string>
 #include <cmath>
 #include <utils/common/NamedObjectCont.h>
+#include <utils/common/NamedRTree.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/ToString.h>
@@ -41,15 +42,37 @@
 // ===========================================================================
 // method definitions
 // ===========================================================================
-ShapeContainer::ShapeContainer() {}
+ShapeContainer::ShapeContainer(const bool lazy) : myAmLazy(lazy), myUnusedPositions(0) {}
 
-ShapeContainer::~ShapeContainer() {}
+ShapeContainer::~ShapeContainer() {
+    for (std::vector<LazyShape*>::const_iterator it = myBuiltShapes.begin(); it != myBuiltShapes.end(); ++it) {
+        delete *it;
+    }
+}
 
 bool
 ShapeContainer::addPolygon(const std::string& id, const std::string& type,
                            const RGBColor& color, double layer,
                            double angle, const std::string& imgFile, bool relativePath,
                            const PositionVector& shape, bool geo, bool fill, bool ignorePruning) {
+    if (myAmLazy) {
+        if (myPolygons.get(id) != 0 || myLazyPolygons.get(id) != 0) {
+            return false;
+        }
+        LazyShape* const poly = new LazyShape(id);
+        poly->type = getStringIndex(type);
+        poly->imgFile = getStringIndex(imgFile);
+        poly->lane = -1;
+        poly->color = color;
+        poly->layer = layer;
+        poly->angle = angle;
+        poly->posOverLane = poly->posLat = poly->width = poly->height = 0.;
+        poly->geo = geo;
+        poly->fill = fill;
+        poly->relativePath = relativePath;
+        storeShape(poly, shape);
+        return myLazyPolygons.add(id, poly);
+    }
     return add(new SUMOPolygon(id, type, color, shape, geo, fill, layer, angle, imgFile, relativePath), ignorePruning);
 }
 
@@ -58,25 +81,59 @@ bool
 ShapeContainer::addPOI(const std::string& id, const std::string& type, const RGBColor& color, const Position& pos, bool geo,
                        const std::string& lane, double posOverLane, double posLat, double layer, double angle,
                        const std::string& imgFile, bool relativePath, double width, double height, bool ignorePruning) {
+    if (myAmLazy) {
+        if (myPOIs.get(id) != 0 || myLazyPOIs.get(id) != 0) {
+            return false;
+        }
+        LazyShape* const poi = new LazyShape(id);
+        poi->type = getStringIndex(type);
+        poi->imgFile = getStringIndex(imgFile);
+        poi->lane = getStringIndex(lane);
+        poi->color = color;
+        poi->layer = layer;
+        poi->angle = angle;
+        poi->posOverLane = posOverLane;
+        poi->posLat = posLat;
+        poi->width = width;
+        poi->height = height;
+        poi->geo = geo;
+        poi->fill = false;
+        poi->relativePath = relativePath;
+        storeShape(poi, PositionVector(std::vector<Position>(1, pos)));
+        return myLazyPOIs.add(id, poi);
+    }
     return add(new PointOfInterest(id, type, color, pos, geo, lane, posOverLane, posLat, layer, angle, imgFile, relativePath, width, height), ignorePruning);
 }
 
 
 bool
 ShapeContainer::removePolygon(const std::string& id) {
+    LazyShape* const poly = myLazyPolygons.get(id);
+    if (poly != 0) {
+        // the record may still be referenced by a tree
+        myLazyPolygons.remove(id, false);
+        releaseShape(poly);
+        return true;
+    }
     return myPolygons.remove(id);
 }
 
 
 bool
 ShapeContainer::removePOI(const std::string& id) {
+    LazyShape* const poi = myLazyPOIs.get(id);
+    if (poi != 0) {
+        myLazyPOIs.remove(id, false);
+        releaseShape(poi);
+        return true;
+    }
     return myPOIs.remove(id);
 }
 
 
 void
 ShapeContainer::movePOI(const std::string& id, const Position& pos) {
-    PointOfInterest* p = myPOIs.get(id);
+    PointOfInterest* p = getPOI(id);
     if (p != 0) {
         static_cast<Position*>(p)->set(pos);
     }
@@ -85,7 +142,7 @@ ShapeContainer::movePOI(const std::string& id, const Position& pos) {
 
 void
 ShapeContainer::reshapePolygon(const std::string& id, const PositionVector& shape) {
-    SUMOPolygon* p = myPolygons.get(id);
+    SUMOPolygon* p = getPolygon(id);
     if (p != 0) {
         p->setShape(shape);
     }
@@ -112,5 +169,157 @@ ShapeContainer::add(PointOfInterest* poi, bool /* ignorePruning */) {
 }
 
 
+SUMOPolygon*
+ShapeContainer::getPolygon(const std::string& id) {
+    SUMOPolygon* p = myPolygons.get(id);
+    if (p == 0) {
+        LazyShape* const poly = myLazyPolygons.get(id);
+        if (poly != 0) {
+            p = new SUMOPolygon(id, myStrings[poly->type], poly->color, getShape(poly), poly->geo, poly->fill,
+                                poly->layer, poly->angle, myStrings[poly->imgFile], poly->relativePath);
+            myLazyPolygons.remove(id, false);
+            releaseShape(poly);
+            myPolygons.add(id, p);
+        }
+    }
+    return p;
+}
+
+
+PointOfInterest*
+ShapeContainer::getPOI(const std::string& id) {
+    PointOfInterest* p = myPOIs.get(id);
+    if (p == 0) {
+        LazyShape* const poi = myLazyPOIs.get(id);
+        if (poi != 0) {
+            p = new PointOfInterest(id, myStrings[poi->type], poi->color, getShape(poi)[0], poi->geo,
+                                    myStrings[poi->lane], poi->posOverLane, poi->posLat, poi->layer, poi->angle,
+                                    myStrings[poi->imgFile], poi->relativePath, poi->width, poi->height);
+            myLazyPOIs.remove(id, false);
+            releaseShape(poi);
+            myPOIs.add(id, p);
+        }
+    }
+    return p;
+}
+
+
+void
+ShapeContainer::insertPolygonIDs(std::vector<std::string>& into) const {
+    myPolygons.insertIDs(into);
+    myLazyPolygons.insertIDs(into);
+}
+
+
+void
+ShapeContainer::insertPOIIDs(std::vector<std::string>& into) const {
+    myPOIs.insertIDs(into);
+    myLazyPOIs.insertIDs(into);
+}
+
+
+void
+ShapeContainer::fillPolygonTree(NamedRTree& into) const {
+    for (Polygons::IDMap::const_iterator it = myPolygons.begin(); it != myPolygons.end(); ++it) {
+        const Boundary b = it->second->getShape().getBoxBoundary();
+        const float cmin[2] = {(float) b.xmin(), (float) b.ymin()};
+        const float cmax[2] = {(float) b.xmax(), (float) b.ymax()};
+        into.Insert(cmin, cmax, it->second);
+    }
+    for (NamedObjectCont<LazyShape*>::IDMap::const_iterator it = myLazyPolygons.begin(); it != myLazyPolygons.end(); ++it) {
+        insertBox(into, it->second);
+    }
+}
+
+
+void
+ShapeContainer::fillPOITree(NamedRTree& into) const {
+    for (POIs::IDMap::const_iterator it = myPOIs.begin(); it != myPOIs.end(); ++it) {
+        const float cmin[2] = {(float)it->second->x(), (float)it->second->y()};
+        const float cmax[2] = {(float)it->second->x(), (float)it->second->y()};
+        into.Insert(cmin, cmax, it->second);
+    }
+    for (NamedObjectCont<LazyShape*>::IDMap::const_iterator it = myLazyPOIs.begin(); it != myLazyPOIs.end(); ++it) {
+        insertBox(into, it->second);
+    }
+}
+
+
+int
+ShapeContainer::getStringIndex(const std::string& value) {
+    std::map<std::string, int>::const_iterator it = myStringIndices.find(value);
+    if (it != myStringIndices.end()) {
+        return it->second;
+    }
+    myStrings.push_back(value);
+    return myStringIndices[value] = (int)myStrings.size() - 1;
+}
+
+
+void
+ShapeContainer::storeShape(LazyShape* const shape, const PositionVector& positions) {
+    shape->begin = (int)myCoordinates.size() / 3;
+    for (PositionVector::const_iterator it = positions.begin(); it != positions.end(); ++it) {
+        myCoordinates.push_back(it->x());
+        myCoordinates.push_back(it->y());
+        myCoordinates.push_back(it->z());
+    }
+    shape->end = (int)myCoordinates.size() / 3;
+}
+
+
+PositionVector
+ShapeContainer::getShape(const LazyShape* const shape) const {
+    PositionVector result;
+    for (int i = shape->begin; i < shape->end; i++) {
+        result.push_back(Position(myCoordinates[3 * i], myCoordinates[3 * i + 1], myCoordinates[3 * i + 2]));
+    }
+    return result;
+}
+
+
+void
+ShapeContainer::insertBox(NamedRTree& into, const LazyShape* const shape) const {
+    if (shape->begin == shape->end) {
+        return;
+    }
+    float cmin[2] = {(float)myCoordinates[3 * shape->begin], (float)myCoordinates[3 * shape->begin + 1]};
+    float cmax[2] = {cmin[0], cmin[1]};
+    for (int i = shape->begin + 1; i < shape->end; i++) {
+        cmin[0] = MIN2(cmin[0], (float)myCoordinates[3 * i]);
+        cmin[1] = MIN2(cmin[1], (float)myCoordinates[3 * i + 1]);
+        cmax[0] = MAX2(cmax[0], (float)myCoordinates[3 * i]);
+        cmax[1] = MAX2(cmax[1], (float)myCoordinates[3 * i + 1]);
+    }
+    into.Insert(cmin, cmax, const_cast<LazyShape*>(shape));
+}
+
+
+void
+ShapeContainer::releaseShape(LazyShape* const shape) {
+    myBuiltShapes.push_back(shape);
+    myUnusedPositions += shape->end - shape->begin;
+    shape->begin = shape->end = 0;
+    if (2 * myUnusedPositions <= (int)myCoordinates.size() / 3) {
+        return;
+    }
+    // move the coordinates of the shapes which were not built yet to a new buffer
+    std::vector<double> coordinates;
+    coordinates.reserve(myCoordinates.size() - 3 * myUnusedPositions);
+    NamedObjectCont<LazyShape*>* const conts[] = {&myLazyPolygons, &myLazyPOIs};
+    for (NamedObjectCont<LazyShape*>* const cont : conts) {
+        for (NamedObjectCont<LazyShape*>::IDMap::const_iterator it = cont->begin(); it != cont->end(); ++it) {
+            LazyShape* const lazy = it->second;
+            const int begin = (int)coordinates.size() / 3;
+            coordinates.insert(coordinates.end(), myCoordinates.begin() + 3 * lazy->begin, myCoordinates.begin() + 3 * lazy->end);
+            lazy->end = begin + lazy->end - lazy->begin;
+            lazy->begin = begin;
+        }
+    }
+    myCoordinates.swap(coordinates);
+    myUnusedPositions = 0;
+}
+
+
 /****************************************************************************/
 
@@ -25,18 +25,33 @@
 // ===========================================================================
 #include <config.h>
 
+#include <map>
 #include <string>
+#include <vector>
 #include <utils/common/NamedObjectCont.h>
 #include "PointOfInterest.h"
 #include "SUMOPolygon.h"
 
 
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class NamedRTree;
+
+
 // ===========================================================================
 // class definitions
 // ===========================================================================
 /**
  * @class ShapeContainer
  * @brief Storage for geometrical objects
+ *
+ * In lazy mode the polygons and POIs are not built on loading but kept as
+ *  compact records (sharing a single coordinate buffer and a table of the
+ *  type and image strings). A shape is built on the first access by id,
+ *  range queries via fillPolygonTree / fillPOITree work on the records.
+ *  Lazy mode is only meant for containers which are not visualised, since
+ *  getPolygons and getPOIs only return the shapes built so far.
  */
 class ShapeContainer {
 public:
@@ -45,8 +60,10 @@ public:
     typedef NamedObjectCont<SUMOPolygon*> Polygons;
     typedef NamedObjectCont<PointOfInterest*> POIs;
 
-    /// @brief Constructor
-    ShapeContainer();
+    /** @brief Constructor
+     * @param[in] lazy Whether shapes shall only be built when accessed
+     */
+    ShapeContainer(const bool lazy = false);
 
     /// @brief Destructor
     virtual ~ShapeContainer();
@@ -115,16 +132,40 @@ public:
      */
     virtual void reshapePolygon(const std::string& id, const PositionVector& shape);
 
-    /// @brief Returns all polygons
+    /// @brief Returns all polygons (only the ones built so far in lazy mode)
     inline const Polygons& getPolygons() const {
         return myPolygons;
     }
 
-    /// @brief Returns all pois
+    /// @brief Returns all pois (only the ones built so far in lazy mode)
     inline const POIs& getPOIs() const {
         return myPOIs;
     }
 
+    /** @brief Returns the named polygon, building it if it is stored lazily
+     * @param[in] id The id of the polygon
+     * @return The polygon or 0 if there is none with this id
+     */
+    SUMOPolygon* getPolygon(const std::string& id);
+
+    /** @brief Returns the named PoI, building it if it is stored lazily
+     * @param[in] id The id of the PoI
+     * @return The PoI or 0 if there is none with this id
+     */
+    PointOfInterest* getPOI(const std::string& id);
+
+    /// @brief Adds the ids of all polygons (including the lazily stored ones) to the given vector
+    void insertPolygonIDs(std::vector<std::string>& into) const;
+
+    /// @brief Adds the ids of all PoIs (including the lazily stored ones) to the given vector
+    void insertPOIIDs(std::vector<std::string>& into) const;
+
+    /// @brief Inserts the bounding boxes of all polygons into the given tree without building lazily stored ones
+    void fillPolygonTree(NamedRTree& into) const;
+
+    /// @brief Inserts the positions of all PoIs into the given tree without building lazily stored ones
+    void fillPOITree(NamedRTree& into) const;
+
 protected:
     /// @brief add polygon
     virtual bool add(SUMOPolygon* poly, bool ignorePruning = false);
@@ -138,6 +179,68 @@ protected:
 
     /// @brief stored POIs
     POIs myPOIs;
+
+private:
+    /// @brief The data of a polygon or PoI which has not been built yet
+    class LazyShape : public Named {
+    public:
+        LazyShape(const std::string& id) : Named(id) {}
+        /// @brief indices into the string table
+        int type, imgFile, lane;
+        RGBColor color;
+        double layer, angle;
+        /// @brief PoI only
+        double posOverLane, posLat, width, height;
+        /// @brief the range of the shape in the coordinate buffer (in positions)
+        int begin, end;
+        bool geo, fill, relativePath;
+    };
+
+    /// @brief returns the index of the given string in the string table, adding it if needed
+    int getStringIndex(const std::string& value);
+
+    /// @brief stores the given positions in the coordinate buffer and sets the range of the shape
+    void storeShape(LazyShape* const shape, const PositionVector& positions);
+
+    /// @brief retrieves the positions of the shape from the coordinate buffer
+    PositionVector getShape(const LazyShape* const shape) const;
+
+    /// @brief inserts the bounding box of the positions of the given shape into the tree
+    void insertBox(NamedRTree& into, const LazyShape* const shape) const;
+
+    /** @brief keeps the record of a built or removed shape and releases its coordinates
+     *
+     * The coordinate buffer is compacted as soon as more than half of it is unused.
+     */
+    void releaseShape(LazyShape* const shape);
+
+private:
+    /// @brief whether shapes are only built when accessed
+    const bool myAmLazy;
+
+    /// @brief the polygons and PoIs which have not been built yet
+    NamedObjectCont<LazyShape*> myLazyPolygons;
+    NamedObjectCont<LazyShape*> myLazyPOIs;
+
+    /// @brief records of built shapes (kept because trees filled before may still refer to them)
+    std::vector<LazyShape*> myBuiltShapes;
+
+    /// @brief the coordinates (x, y, z) of all lazily stored shapes
+    std::vector<double> myCoordinates;
+
+    /// @brief the number of positions in the coordinate buffer belonging to built or removed shapes
+    int myUnusedPositions;
+
+    /// @brief the table of type, image file and lane strings
+    std::vector<std::string> myStrings;
+    std::map<std::string, int> myStringIndices;
+
+private:
+    /// @brief invalidated copy constructor
+    ShapeContainer(const ShapeContainer& s) = delete;
+
+    /// @brief invalidated assignment operator
+    ShapeContainer& operator=(const ShapeContainer& s) = delete;
 };
 
 
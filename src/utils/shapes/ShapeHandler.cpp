@@ -43,7 +43,8 @@
 ShapeHandler::ShapeHandler(const std::string& file, ShapeContainer& sc) :
     SUMOSAXHandler(file), myShapeContainer(sc),
     myPrefix(""), myDefaultColor(RGBColor::RED), myDefaultLayer(), myDefaultFill(false),
-    myLastParameterised(0) {
+    myLastParameterised(0),
+    myLastShapeIsPOI(false) {
 }
 
 
@@ -63,6 +64,13 @@ ShapeHandler::myStartElement(int element, const SUMOSAXAttributes& attrs) {
                 addPOI(attrs, false, false);
                 break;
             case SUMO_TAG_PARAM:
+                if (myLastParameterised == 0 && myLastShapeID != "") {
+                    if (myLastShapeIsPOI) {
+                        myLastParameterised = myShapeContainer.getPOI(myLastShapeID);
+                    } else {
+                        myLastParameterised = myShapeContainer.getPolygon(myLastShapeID);
+                    }
+                }
                 if (myLastParameterised != 0) {
                     bool ok = true;
                     const std::string key = attrs.get<std::string>(SUMO_ATTR_KEY, 0, ok);
@@ -83,6 +91,7 @@ void
 ShapeHandler::myEndElement(int element) {
     if (element != SUMO_TAG_PARAM) {
         myLastParameterised = 0;
+        myLastShapeID = "";
     }
 }
 
@@ -152,8 +161,10 @@ ShapeHandler::addPOI(const SUMOSAXAttributes& attrs, const bool ignorePruning, c
     if (!myShapeContainer.addPOI(id, type, color, pos, useGeo, laneID, lanePos, lanePosLat, layer, angle, imgFile, relativePath, width, height, ignorePruning)) {
         WRITE_ERROR("PoI '" + id + "' already exists.");
     }
-    myLastParameterised = myShapeContainer.getPOIs().get(id);
+    myLastShapeID = id;
+    myLastShapeIsPOI = true;
     if (laneID != "" && addLanePosParams()) {
+        myLastParameterised = myShapeContainer.getPOI(id);
         myLastParameterised->setParameter(toString(SUMO_ATTR_LANE), laneID);
         myLastParameterised->setParameter(toString(SUMO_ATTR_POSITION), toString(lanePos));
         myLastParameterised->setParameter(toString(SUMO_ATTR_POSITION_LAT), toString(lanePosLat));
@@ -204,7 +215,8 @@ ShapeHandler::addPoly(const SUMOSAXAttributes& attrs, const bool ignorePruning,
     if (!myShapeContainer.addPolygon(id, type, color, layer, angle, imgFile, relativePath, shape, geo, fill, ignorePruning)) {
         WRITE_ERROR("Polygon '" + id + "' already exists.");
     }
-    myLastParameterised = myShapeContainer.getPolygons().get(id);
+    myLastShapeID = id;
+    myLastShapeIsPOI = false;
 }
 
 
@@ -125,6 +125,12 @@ private:
     /// @brief element to receive parameters
     Parameterised* myLastParameterised;
 
+    /// @brief the id of the last loaded shape (built only when receiving parameters to keep lazily stored shapes compact)
+    std::string myLastShapeID;
+
+    /// @brief whether the last loaded shape is a PoI
+    bool myLastShapeIsPOI;
+
 private:
     /// @brief invalidate copy constructor
     ShapeHandler(const ShapeHandler& s) = delete;
@@ -44,6 +44,7 @@
 #include <utils/iodevices/BinaryInputDevice.h>
 #include <utils/iodevices/OutputDevice.h>
 #include "AStarLookupTable.h"
+#include "FrontierHeap.h"
 #include "SUMOAbstractRouter.h"
 
 #define UNREACHABLE (std::numeric_limits<double>::max() / 1000.0)
@@ -124,21 +125,6 @@ public:
 
     };
 
-    /**
-     * @class EdgeInfoComparator
-     * Class to compare (and so sort) nodes by their effort
-     */
-    class EdgeInfoComparator {
-    public:
-        /// Comparing method
-        bool operator()(const EdgeInfo* nod1, const EdgeInfo* nod2) const {
-            if (nod1->heuristicTime == nod2->heuristicTime) {
-                return nod1->edge->getNumericalID() > nod2->edge->getNumericalID();
-            }
-            return nod1->heuristicTime > nod2->heuristicTime;
-        }
-    };
-
     /// Constructor
     AStarRouter(const std::vector<E*>& edges, bool unbuildIsWarning, Operation operation, const LookupTable* const lookup = 0):
         SUMOAbstractRouter<E, V>(operation, "AStarRouter"),
@@ -149,6 +135,7 @@ public:
             myEdgeInfos.push_back(EdgeInfo(*i));
             myMaxSpeed = MAX2(myMaxSpeed, (*i)->getSpeedLimit() * MAX2(1.0, (*i)->getLengthGeometryFactor()));
         }
+        myFrontier.resize((int)myEdgeInfos.size());
     }
 
     AStarRouter(const std::vector<EdgeInfo>& edgeInfos, bool unbuildIsWarning, Operation operation, const LookupTable* const lookup = 0):
@@ -160,6 +147,7 @@ public:
             myEdgeInfos.push_back(EdgeInfo(i->edge));
             myMaxSpeed = MAX2(myMaxSpeed, i->edge->getSpeedLimit() * i->edge->getLengthGeometryFactor());
         }
+        myFrontier.resize((int)myEdgeInfos.size());
     }
 
     /// Destructor
@@ -170,11 +158,11 @@ public:
     }
 
     void init() {
-        // all EdgeInfos touched in the previous query are either in myFrontierList or myFound: clean those up
-        for (typename std::vector<EdgeInfo*>::iterator i = myFrontierList.begin(); i != myFrontierList.end(); i++) {
-            (*i)->reset();
+        // all EdgeInfos touched in the previous query are either in myFrontier or myFound: clean those up
+        for (int i = 0; i < myFrontier.size(); i++) {
+            myEdgeInfos[myFrontier.at(i)].reset();
         }
-        myFrontierList.clear();
+        myFrontier.clear();
         for (typename std::vector<EdgeInfo*>::iterator i = myFound.begin(); i != myFound.end(); i++) {
             (*i)->reset();
         }
@@ -214,16 +202,16 @@ public:
             EdgeInfo* const fromInfo = &(myEdgeInfos[from->getNumericalID()]);
             fromInfo->traveltime = 0;
             fromInfo->prev = 0;
-            myFrontierList.push_back(fromInfo);
+            myFrontier.update(from->getNumericalID(), 0);
         }
         // loop
         int num_visited = 0;
         const bool mayRevisit = myLookupTable != 0 && !myLookupTable->consistent();
         const double speed = vehicle == nullptr ? myMaxSpeed : MIN2(vehicle->getMaxSpeed(), myMaxSpeed * vehicle->getChosenSpeedFactor());
-        while (!myFrontierList.empty()) {
+        while (!myFrontier.empty()) {
             num_visited += 1;
             // use the node with the minimal length
-            EdgeInfo* const minimumInfo = myFrontierList.front();
+            EdgeInfo* const minimumInfo = &myEdgeInfos[myFrontier.top()];
             const E* const minEdge = minimumInfo->edge;
             // check whether the destination node was already reached
             if (minEdge == to) {
@@ -245,8 +233,7 @@ public:
 #endif
                 return true;
             }
-            pop_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
-            myFrontierList.pop_back();
+            myFrontier.pop();
             myFound.push_back(minimumInfo);
             minimumInfo->visited = true;
 #ifdef ASTAR_DEBUG_QUERY
@@ -255,8 +242,9 @@ public:
                       << " EF=" << this->getEffort(minEdge, vehicle, time + minimumInfo->traveltime)
                       << " HT=" << minimumInfo->heuristicTime
                       << " Q(TT,HT,Edge)=";
-            for (typename std::vector<EdgeInfo*>::iterator it = myFrontierList.begin(); it != myFrontierList.end(); it++) {
-                std::cout << (*it)->traveltime << "," << (*it)->heuristicTime << "," << (*it)->edge->getID() << " ";
+            for (int i = 0; i < myFrontier.size(); i++) {
+                const EdgeInfo& ei = myEdgeInfos[myFrontier.at(i)];
+                std::cout << ei.traveltime << "," << ei.heuristicTime << "," << ei.edge->getID() << " ";
             }
             std::cout << "\n";
 #endif
@@ -295,19 +283,8 @@ public:
                     std::cout << "   follower=" << followerInfo->edge->getID() << " OEF=" << oldEffort << " TT=" << traveltime << " HR=" << heuristic_remaining << " HT=" << followerInfo->heuristicTime << "\n";
 #endif
                     followerInfo->prev = minimumInfo;
-                    if (oldEffort == std::numeric_limits<double>::max()) {
-                        myFrontierList.push_back(followerInfo);
-                        push_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
-                    } else {
-                        typename std::vector<EdgeInfo*>::iterator fi = find(myFrontierList.begin(), myFrontierList.end(), followerInfo);
-                        if (fi == myFrontierList.end()) {
-                            assert(mayRevisit);
-                            myFrontierList.push_back(followerInfo);
-                            push_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
-                        } else {
-                            push_heap(myFrontierList.begin(), fi + 1, myComparator);
-                        }
-                    }
+                    assert(oldEffort == std::numeric_limits<double>::max() || mayRevisit || myFrontier.contains(follower->getNumericalID()));
+                    myFrontier.update(follower->getNumericalID(), followerInfo->heuristicTime);
                 }
             }
         }
@@ -347,13 +324,11 @@ protected:
     /// The container of edge information
     std::vector<EdgeInfo> myEdgeInfos;
 
-    /// A container for reusage of the min edge heap
-    std::vector<EdgeInfo*> myFrontierList;
+    /// @brief the frontier (numerical ids of the edges keyed by their heuristic time)
+    FrontierHeap myFrontier;
     /// @brief list of visited Edges (for resetting)
     std::vector<EdgeInfo*> myFound;
 
-    EdgeInfoComparator myComparator;
-
     /// @brief the handler for routing errors
     MsgHandler* const myErrorMsgHandler;
 
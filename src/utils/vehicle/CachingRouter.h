@@ -0,0 +1,214 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    CachingRouter.h
+/// @author  agent
+/// @date    2026-10-18
+/// @version $Id$
+///
+// Wraps a router and reuses the routes of repeated origin-destination queries
+/****************************************************************************/
+#ifndef CachingRouter_h
+#define CachingRouter_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <config.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <utils/common/SysUtils.h>
+#include <utils/common/SUMOVehicleClass.h>
+#include <utils/common/MsgHandler.h>
+#include <utils/common/ToString.h>
+#include "SUMOAbstractRouter.h"
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class CachingRouter
+ * @brief Wraps a router and remembers the routes it found
+ *
+ * A route is reused for a later query with the same origin and destination
+ *  if the vehicle has the same type, class, maximum speed and speed factor
+ *  (which are all the vehicle properties the edge efforts and permissions
+ *  depend on) and the query falls into the same weight epoch.
+ *
+ * The epoch is either given by an external counter (which has to be increased
+ *  whenever the edge weights or the edge permissions change) or by the interval of constant edge weights
+ *  the departure falls into. In the latter case a route is only cached and
+ *  reused if the whole trip ends before the next change of the edge weights,
+ *  because a route crossing the boundary may depend on the departure time.
+ *  Whenever a newer epoch is seen, all cached routes are discarded. Queries
+ *  without destination and failed queries are never cached.
+ *
+ * Every clone has its own cache, so no locking is needed when the clones
+ *  are used by different threads.
+ *
+ * The template parameters are:
+ * @param E The edge class to use (MSEdge/ROEdge)
+ * @param V The vehicle class to use (MSVehicle/ROVehicle)
+ */
+template<class E, class V>
+class CachingRouter : public SUMOAbstractRouter<E, V> {
+public:
+    /// Type of the function that is used to retrieve the current weight epoch
+    typedef long long int(* EpochOperation)();
+
+    /** @brief Constructor
+     *
+     * @param[in] router The router answering the cache misses (is deleted by the wrapper)
+     * @param[in] operation The effort operation of the wrapped router
+     * @param[in] weightChanges The sorted times at which the edge weights change
+     * @param[in] epochOperation The function retrieving the weight epoch (overrides the weight changes if given)
+     * @param[in] ttOperation The travel time operation for checking whether a trip ends before the next weight change
+     */
+    CachingRouter(SUMOAbstractRouter<E, V>* router, typename SUMOAbstractRouter<E, V>::Operation operation,
+                  const std::vector<SUMOTime>& weightChanges, EpochOperation epochOperation = nullptr,
+                  typename SUMOAbstractRouter<E, V>::Operation ttOperation = nullptr) :
+        SUMOAbstractRouter<E, V>(operation, "CachingRouter"),
+        myRouter(router),
+        myWeightChanges(weightChanges),
+        myEpochOperation(epochOperation),
+        myTTOperation(ttOperation == nullptr ? operation : ttOperation),
+        myLastEpoch(0),
+        myNumHits(0),
+        myNumMisses(0),
+        myMissTimeSum(0) {
+    }
+
+    /// Destructor
+    virtual ~CachingRouter() {
+        if (myNumHits + myNumMisses > 0) {
+            const double missTime = myNumMisses > 0 ? double(myMissTimeSum) / myNumMisses : 0.;
+            WRITE_MESSAGE("CachingRouter answered " + toString(myNumHits) + " of " + toString(myNumHits + myNumMisses) +
+                          " queries from the cache (" + toString(100. * myNumHits / (myNumHits + myNumMisses)) + "% hit rate).");
+            WRITE_MESSAGE("CachingRouter saved an estimated " + toString(missTime * myNumHits) + "ms (" + toString(missTime) + "ms per cache miss).");
+        }
+        delete myRouter;
+    }
+
+    virtual SUMOAbstractRouter<E, V>* clone() {
+        return new CachingRouter<E, V>(myRouter->clone(), this->myOperation, myWeightChanges, myEpochOperation, myTTOperation);
+    }
+
+    bool compute(const E* from, const E* to, const V* const vehicle,
+                 SUMOTime msTime, std::vector<const E*>& into) {
+        myRouter->setBulkMode(this->myBulkMode);
+        if (to == nullptr) {
+            return myRouter->compute(from, to, vehicle, msTime, into);
+        }
+        long long int epoch;
+        double epochEnd = std::numeric_limits<double>::max();
+        if (myEpochOperation != nullptr) {
+            epoch = (*myEpochOperation)();
+        } else {
+            const std::vector<SUMOTime>::const_iterator next = std::upper_bound(myWeightChanges.begin(), myWeightChanges.end(), msTime);
+            epoch = next - myWeightChanges.begin();
+            if (next != myWeightChanges.end()) {
+                epochEnd = STEPS2TIME(*next);
+            }
+        }
+        if (epoch > myLastEpoch) {
+            myCache.clear();
+            myLastEpoch = epoch;
+        }
+        CacheKey key;
+        if (vehicle == nullptr) {
+            key = CacheKey(from, to, "", SVC_IGNORING, -1., -1., epoch);
+        } else {
+            key = CacheKey(from, to, vehicle->getParameter().vtypeid, vehicle->getVClass(),
+                           vehicle->getMaxSpeed(), vehicle->getChosenSpeedFactor(), epoch);
+        }
+        typename std::map<CacheKey, CacheEntry>::const_iterator it = myCache.find(key);
+        if (it != myCache.end() && STEPS2TIME(msTime) + it->second.second <= epochEnd) {
+            myNumHits++;
+            into.insert(into.end(), it->second.first.begin(), it->second.first.end());
+            return true;
+        }
+        myNumMisses++;
+        const long long int start = SysUtils::getCurrentMillis();
+        const int oldSize = (int)into.size();
+        const bool result = myRouter->compute(from, to, vehicle, msTime, into);
+        myMissTimeSum += SysUtils::getCurrentMillis() - start;
+        if (result) {
+            const std::vector<const E*> route(into.begin() + oldSize, into.end());
+            const double duration = getDuration(route, vehicle, STEPS2TIME(msTime), epochEnd);
+            if (STEPS2TIME(msTime) + duration <= epochEnd) {
+                myCache[key] = std::make_pair(route, duration);
+            }
+        }
+        return result;
+    }
+
+    double recomputeCosts(const std::vector<const E*>& edges, const V* const v, SUMOTime msTime) const {
+        return myRouter->recomputeCosts(edges, v, msTime);
+    }
+
+private:
+    /// @brief returns the travel time of the route (only computed if the weights change at all)
+    double getDuration(const std::vector<const E*>& route, const V* const vehicle, const double time, const double epochEnd) const {
+        if (epochEnd == std::numeric_limits<double>::max()) {
+            return 0.;
+        }
+        double t = time;
+        for (const E* const e : route) {
+            t += (*myTTOperation)(e, vehicle, t);
+        }
+        return t - time;
+    }
+
+private:
+    /// @brief origin, destination, vehicle type, vehicle class, maximum speed, speed factor and weight epoch
+    typedef std::tuple<const E*, const E*, std::string, SUMOVehicleClass, double, double, long long int> CacheKey;
+
+    /// @brief the cached route and its travel time
+    typedef std::pair<std::vector<const E*>, double> CacheEntry;
+
+    /// @brief the wrapped router
+    SUMOAbstractRouter<E, V>* const myRouter;
+
+    /// @brief the sorted times at which the edge weights change
+    const std::vector<SUMOTime> myWeightChanges;
+
+    /// @brief the function retrieving the weight epoch
+    EpochOperation myEpochOperation;
+
+    /// @brief the function retrieving the travel times
+    typename SUMOAbstractRouter<E, V>::Operation myTTOperation;
+
+    /// @brief the newest epoch seen so far
+    long long int myLastEpoch;
+
+    /// @brief the routes found so far
+    std::map<CacheKey, CacheEntry> myCache;
+
+    /// @brief counters for performance logging
+    long long int myNumHits;
+    long long int myNumMisses;
+    /// @brief the time spent answering the cache misses in milliseconds
+    long long int myMissTimeSum;
+
+private:
+    /// @brief Invalidated assignment operator
+    CachingRouter& operator=(const CachingRouter& s) = delete;
+};
+
+
+#endif
+
+/****************************************************************************/
@@ -36,6 +36,7 @@
 #include <utils/common/ToString.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/StdDefs.h>
+#include "FrontierHeap.h"
 #include "SUMOAbstractRouter.h"
 
 //#define DijkstraRouter_DEBUG_QUERY
@@ -102,22 +103,6 @@ public:
 
     };
 
-    /**
-     * @class EdgeInfoByEffortComparator
-     * Class to compare (and so sort) nodes by their effort
-     */
-    class EdgeInfoByEffortComparator {
-    public:
-        /// Comparing method
-        bool operator()(const EdgeInfo* nod1, const EdgeInfo* nod2) const {
-            if (nod1->effort == nod2->effort) {
-                return nod1->edge->getNumericalID() > nod2->edge->getNumericalID();
-            }
-            return nod1->effort > nod2->effort;
-        }
-    };
-
-
     /// Constructor
     DijkstraRouter(const std::vector<E*>& edges, bool unbuildIsWarning, Operation effortOperation, Operation ttOperation = nullptr) :
         SUMOAbstractRouter<E, V>(effortOperation, "DijkstraRouter"), myTTOperation(ttOperation),
@@ -125,6 +110,7 @@ public:
         for (typename std::vector<E*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
             myEdgeInfos.push_back(EdgeInfo(*i));
         }
+        myFrontier.resize((int)myEdgeInfos.size());
     }
 
     /// Destructor
@@ -139,11 +125,11 @@ public:
     }
 
     void init() {
-        // all EdgeInfos touched in the previous query are either in myFrontierList or myFound: clean those up
-        for (typename std::vector<EdgeInfo*>::iterator i = myFrontierList.begin(); i != myFrontierList.end(); i++) {
-            (*i)->reset();
+        // all EdgeInfos touched in the previous query are either in myFrontier or myFound: clean those up
+        for (int i = 0; i < myFrontier.size(); i++) {
+            myEdgeInfos[myFrontier.at(i)].reset();
         }
-        myFrontierList.clear();
+        myFrontier.clear();
         for (typename std::vector<EdgeInfo*>::iterator i = myFound.begin(); i != myFound.end(); i++) {
             (*i)->reset();
         }
@@ -152,16 +138,17 @@ public:
 
 
     /** @brief Builds the route between the given edges using the minimum effort at the given time
-        The definition of the effort depends on the wished routing scheme */
+        The definition of the effort depends on the wished routing scheme.
+        If to is 0 all edges reachable from the origin are explored (see getEdgeInfo) */
     virtual bool compute(const E* from, const E* to, const V* const vehicle,
                          SUMOTime msTime, std::vector<const E*>& into) {
-        assert(from != 0 && (vehicle == 0 || to != 0));
+        assert(from != 0);
         // check whether from and to can be used
         if (PF::operator()(from, vehicle)) {
             myErrorMsgHandler->inform("Vehicle '" + vehicle->getID() + "' is not allowed on source edge '" + from->getID() + "'.");
             return false;
         }
-        if (PF::operator()(to, vehicle)) {
+        if (to != 0 && PF::operator()(to, vehicle)) {
             myErrorMsgHandler->inform("Vehicle '" + vehicle->getID() + "' is not allowed on destination edge '" + to->getID() + "'.");
             return false;
         }
@@ -184,14 +171,14 @@ public:
             fromInfo->effort = 0;
             fromInfo->prev = 0;
             fromInfo->leaveTime = STEPS2TIME(msTime);
-            myFrontierList.push_back(fromInfo);
+            myFrontier.update(from->getNumericalID(), 0);
         }
         // loop
         int num_visited = 0;
-        while (!myFrontierList.empty()) {
+        while (!myFrontier.empty()) {
             num_visited += 1;
             // use the node with the minimal length
-            EdgeInfo* const minimumInfo = myFrontierList.front();
+            EdgeInfo* const minimumInfo = &myEdgeInfos[myFrontier.top()];
             const E* const minEdge = minimumInfo->edge;
             // check whether the destination node was already reached
             if (minEdge == to) {
@@ -202,14 +189,13 @@ public:
 #endif
                 return true;
             }
-            pop_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
-            myFrontierList.pop_back();
+            myFrontier.pop();
             myFound.push_back(minimumInfo);
             minimumInfo->visited = true;
 #ifdef DijkstraRouter_DEBUG_QUERY
             std::cout << "DEBUG: hit '" << minEdge->getID() << "' Eff: " << minimumInfo->effort << ", TT: " << minimumInfo->leaveTime << " Q: ";
-            for (typename std::vector<EdgeInfo*>::iterator it = myFrontierList.begin(); it != myFrontierList.end(); it++) {
-                std::cout << (*it)->effort << "," << (*it)->edge->getID() << " ";
+            for (int i = 0; i < myFrontier.size(); i++) {
+                std::cout << myEdgeInfos[myFrontier.at(i)].effort << "," << myEdgeInfos[myFrontier.at(i)].edge->getID() << " ";
             }
             std::cout << "\n";
 #endif
@@ -222,24 +208,17 @@ public:
             const std::vector<E*>& successors = minEdge->getSuccessors(vClass);
             for (typename std::vector<E*>::const_iterator it = successors.begin(); it != successors.end(); ++it) {
                 const E* const follower = *it;
-                EdgeInfo* const followerInfo = &(myEdgeInfos[follower->getNumericalID()]);
+                const int followerIndex = follower->getNumericalID();
+                EdgeInfo* const followerInfo = &(myEdgeInfos[followerIndex]);
                 // check whether it can be used
                 if (PF::operator()(follower, vehicle)) {
                     continue;
                 }
-                const double oldEffort = followerInfo->effort;
-                if (!followerInfo->visited && effort < oldEffort) {
+                if (!followerInfo->visited && effort < followerInfo->effort) {
                     followerInfo->effort = effort;
                     followerInfo->leaveTime = leaveTime;
                     followerInfo->prev = minimumInfo;
-                    if (oldEffort == std::numeric_limits<double>::max()) {
-                        myFrontierList.push_back(followerInfo);
-                        push_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
-                    } else {
-                        push_heap(myFrontierList.begin(),
-                                  find(myFrontierList.begin(), myFrontierList.end(), followerInfo) + 1,
-                                  myComparator);
-                    }
+                    myFrontier.update(followerIndex, effort);
                 }
             }
         }
@@ -289,6 +268,7 @@ private:
         for (const EdgeInfo& ei : edgeInfos) {
             myEdgeInfos.push_back(EdgeInfo(ei.edge));
         }
+        myFrontier.resize((int)myEdgeInfos.size());
     }
 
 private:
@@ -298,13 +278,11 @@ private:
     /// The container of edge information
     std::vector<EdgeInfo> myEdgeInfos;
 
-    /// A container for reusage of the min edge heap
-    std::vector<EdgeInfo*> myFrontierList;
+    /// @brief the frontier (numerical ids of the edges keyed by their effort)
+    FrontierHeap myFrontier;
     /// @brief list of visited Edges (for resetting)
     std::vector<EdgeInfo*> myFound;
 
-    EdgeInfoByEffortComparator myComparator;
-
     /// @brief the handler for routing errors
     MsgHandler* const myErrorMsgHandler;
 };
@@ -0,0 +1,196 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    FrontierHeap.h
+/// @author  agent
+/// @date    2026-10-18
+/// @version $Id$
+///
+// An indexed 4-ary min heap with decrease key for the router frontiers
+/****************************************************************************/
+#ifndef FrontierHeap_h
+#define FrontierHeap_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <config.h>
+
+#include <cassert>
+#include <vector>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class FrontierHeap
+ * @brief A 4-ary min heap of edge indices (numerical ids) with their keys
+ *
+ * The keys are stored together with the index in the heap array so the sift
+ *  operations only touch this contiguous array (four children fill a cache
+ *  line) instead of dereferencing the edge infos. The position of each index
+ *  in the heap is tracked which allows decreasing a key in O(log n) instead of
+ *  searching the frontier linearly.
+ *
+ * Equal keys are ordered by index, so the order in which elements are popped
+ *  is exactly the same as for the std::push_heap/std::pop_heap frontiers the
+ *  routers used before.
+ */
+class FrontierHeap {
+public:
+    /// @brief Constructor
+    FrontierHeap(const int numIndices = 0) : myPositions(numIndices, -1) {}
+
+    /// @brief sets the number of possible indices (and clears the heap)
+    void resize(const int numIndices) {
+        myHeap.clear();
+        myPositions.assign(numIndices, -1);
+    }
+
+    /// @brief whether the heap is empty
+    inline bool empty() const {
+        return myHeap.empty();
+    }
+
+    /// @brief the number of elements in the heap
+    inline int size() const {
+        return (int)myHeap.size();
+    }
+
+    /// @brief the index with the minimum key
+    inline int top() const {
+        return myHeap.front().index;
+    }
+
+    /// @brief the minimum key
+    inline double topKey() const {
+        return myHeap.front().key;
+    }
+
+    /// @brief the index at the given heap position (for iterating in arbitrary order)
+    inline int at(const int pos) const {
+        return myHeap[pos].index;
+    }
+
+    /// @brief whether the index is currently in the heap
+    inline bool contains(const int index) const {
+        return myPositions[index] >= 0;
+    }
+
+    /** @brief inserts the index or changes its key if it is already contained
+     *
+     * Keys usually only decrease (Dijkstra), but the A* key of an edge may grow
+     *  when it is reached with a smaller travel time from an edge with a worse
+     *  heuristic estimate, so both directions are supported.
+     */
+    void update(const int index, const double key) {
+        const int pos = myPositions[index];
+        if (pos < 0) {
+            myHeap.push_back(Entry(key, index));
+            siftUp((int)myHeap.size() - 1);
+        } else if (key > myHeap[pos].key) {
+            myHeap[pos].key = key;
+            siftDown(pos);
+        } else {
+            myHeap[pos].key = key;
+            siftUp(pos);
+        }
+    }
+
+    /// @brief removes the element with the minimum key
+    void pop() {
+        assert(!myHeap.empty());
+        myPositions[myHeap.front().index] = -1;
+        const Entry last = myHeap.back();
+        myHeap.pop_back();
+        if (!myHeap.empty()) {
+            myHeap.front() = last;
+            myPositions[last.index] = 0;
+            siftDown(0);
+        }
+    }
+
+    /// @brief removes all elements
+    void clear() {
+        for (const Entry& e : myHeap) {
+            myPositions[e.index] = -1;
+        }
+        myHeap.clear();
+    }
+
+private:
+    /// @brief an element of the heap
+    struct Entry {
+        Entry(const double k, const int i) : key(k), index(i) {}
+        double key;
+        int index;
+    };
+
+    /// @brief whether a has to be popped before b
+    static inline bool less(const Entry& a, const Entry& b) {
+        return a.key < b.key || (a.key == b.key && a.index < b.index);
+    }
+
+    void siftUp(int pos) {
+        const Entry e = myHeap[pos];
+        while (pos > 0) {
+            const int parent = (pos - 1) / 4;
+            if (!less(e, myHeap[parent])) {
+                break;
+            }
+            myHeap[pos] = myHeap[parent];
+            myPositions[myHeap[pos].index] = pos;
+            pos = parent;
+        }
+        myHeap[pos] = e;
+        myPositions[e.index] = pos;
+    }
+
+    void siftDown(int pos) {
+        const int n = (int)myHeap.size();
+        const Entry e = myHeap[pos];
+        while (true) {
+            const int first = 4 * pos + 1;
+            if (first >= n) {
+                break;
+            }
+            const int last = first + 4 < n ? first + 4 : n;
+            int best = first;
+            for (int c = first + 1; c < last; c++) {
+                if (less(myHeap[c], myHeap[best])) {
+                    best = c;
+                }
+            }
+            if (!less(myHeap[best], e)) {
+                break;
+            }
+            myHeap[pos] = myHeap[best];
+            myPositions[myHeap[pos].index] = pos;
+            pos = best;
+        }
+        myHeap[pos] = e;
+        myPositions[e.index] = pos;
+    }
+
+private:
+    /// @brief the heap array
+    std::vector<Entry> myHeap;
+
+    /// @brief the position of each index in the heap (-1 if not contained)
+    std::vector<int> myPositions;
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
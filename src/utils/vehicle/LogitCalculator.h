@@ -54,6 +54,8 @@ public:
     void calculateProbabilities(std::vector<R*> alternatives, const V* const veh, const SUMOTime time) {
         const double theta = myTheta >= 0 ? myTheta : getThetaForCLogit(alternatives);
         const double beta = myBeta >= 0 ? myBeta : getBetaForCLogit(alternatives);
+        // the commonalities are local to allow parallel calls for disjoint alternatives
+        std::map<const R*, double> commonalities;
         if (beta > 0) {
             // calculate commonalities
             for (typename std::vector<R*>::const_iterator i = alternatives.begin(); i != alternatives.end(); i++) {
@@ -78,7 +80,7 @@ public:
                     }
                     overlapSum += pow(overlapLength / sqrt(lengthR * lengthS), myGamma);
                 }
-                myCommonalities[pR] = beta * log(overlapSum);
+                commonalities[pR] = beta * log(overlapSum);
             }
         }
         for (typename std::vector<R*>::iterator i = alternatives.begin(); i != alternatives.end(); i++) {
@@ -86,7 +88,7 @@ public:
             double weightedSum = 0;
             for (typename std::vector<R*>::iterator j = alternatives.begin(); j != alternatives.end(); j++) {
                 R* pS = *j;
-                weightedSum += exp(theta * (pR->getCosts() - pS->getCosts() + myCommonalities[pR] - myCommonalities[pS]));
+                weightedSum += exp(theta * (pR->getCosts() - pS->getCosts() + commonalities[pR] - commonalities[pS]));
             }
             pR->setProbability(1. / weightedSum);
         }
@@ -142,9 +144,6 @@ private:
     /// @brief logit theta - value
     const double myTheta;
 
-    /// @brief The route commonality factors for c-logit
-    std::map<const R*, double> myCommonalities;
-
 private:
     /** @brief invalidated assignment operator */
     LogitCalculator& operator=(const LogitCalculator& s);
@@ -0,0 +1,175 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    ManyToManyRouter.h
+/// @author  agent
+/// @date    2026-10-18
+/// @version $Id$
+///
+// Computes cost matrices between sets of edges by one-to-all searches
+/****************************************************************************/
+#ifndef ManyToManyRouter_h
+#define ManyToManyRouter_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <config.h>
+
+#include <vector>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
+#include "DijkstraRouter.h"
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class ManyToManyRouter
+ * @brief Computes the costs between all pairs of origin and destination edges
+ *
+ * For every origin a single Dijkstra search explores the whole reachable
+ *  network, the costs of all destinations are then read from the edge infos
+ *  instead of building and recomputing each route. The origins are distributed
+ *  over a thread pool (each worker owns its router) if threads are given.
+ *
+ * The cost of a pair includes both the origin and the destination edge,
+ *  matching SUMOAbstractRouter::recomputeCosts for the shortest route.
+ *  Unreachable destinations get a cost of -1.
+ *
+ * The template parameters are:
+ * @param E The edge class to use (MSEdge/ROEdge)
+ * @param V The vehicle class to use (MSVehicle/ROVehicle)
+ * @param PF The prohibition function to use (prohibited_withPermissions/noProhibitions)
+ */
+template<class E, class V, class PF>
+class ManyToManyRouter {
+public:
+    typedef DijkstraRouter<E, V, PF> Router;
+    typedef typename Router::Operation Operation;
+
+    /// Constructor
+    ManyToManyRouter(const std::vector<E*>& edges, bool unbuildIsWarning, Operation effortOperation,
+                     Operation ttOperation = nullptr, const int numThreads = 0) :
+        myRouter(edges, unbuildIsWarning, effortOperation, ttOperation) {
+#ifdef HAVE_FOX
+        while ((int)myThreadPool.size() < numThreads) {
+            new WorkerThread(myThreadPool, static_cast<Router*>(myRouter.clone()));
+        }
+#else
+        UNUSED_PARAMETER(numThreads);
+#endif
+    }
+
+    /// Destructor
+    virtual ~ManyToManyRouter() {}
+
+    /** @brief Computes the cost matrix
+     *
+     * @param[in] origins The origin edges (rows)
+     * @param[in] destinations The destination edges (columns)
+     * @param[in] vehicle The vehicle to route (may be 0)
+     * @param[in] msTime The departure time
+     * @param[out] into The costs in row major order (origins.size() * destinations.size())
+     */
+    void compute(const std::vector<const E*>& origins, const std::vector<const E*>& destinations,
+                 const V* const vehicle, SUMOTime msTime, std::vector<double>& into) {
+        const int numDests = (int)destinations.size();
+        into.assign(origins.size() * destinations.size(), -1.);
+        if (numDests == 0) {
+            return;
+        }
+#ifdef HAVE_FOX
+        if (myThreadPool.size() > 0) {
+            for (int i = 0; i < (int)origins.size(); i++) {
+                myThreadPool.add(new RowTask(origins[i], destinations, vehicle, msTime, &into[i * numDests]));
+            }
+            myThreadPool.waitAll();
+            return;
+        }
+#endif
+        for (int i = 0; i < (int)origins.size(); i++) {
+            computeRow(myRouter, origins[i], destinations, vehicle, msTime, &into[i * numDests]);
+        }
+    }
+
+private:
+    /// @brief runs a one-to-all search from origin and fills the row with the destination costs
+    static void computeRow(Router& router, const E* origin, const std::vector<const E*>& destinations,
+                           const V* const vehicle, SUMOTime msTime, double* row) {
+        std::vector<const E*> into;
+        router.compute(origin, 0, vehicle, msTime, into);
+        for (const E* const dest : destinations) {
+            const typename Router::EdgeInfo& info = router.getEdgeInfo(dest->getNumericalID());
+            if (info.visited) {
+                *row = info.effort + router.getEffort(dest, vehicle, info.leaveTime);
+            }
+            row++;
+        }
+    }
+
+#ifdef HAVE_FOX
+private:
+    class WorkerThread : public FXWorkerThread {
+    public:
+        WorkerThread(FXWorkerThread::Pool& pool, Router* router)
+            : FXWorkerThread(pool), myRouter(router) {}
+        virtual ~WorkerThread() {
+            stop();
+            delete myRouter;
+        }
+        Router& getRouter() {
+            return *myRouter;
+        }
+    private:
+        Router* const myRouter;
+    };
+
+    class RowTask : public FXWorkerThread::Task {
+    public:
+        RowTask(const E* origin, const std::vector<const E*>& destinations, const V* const vehicle,
+                SUMOTime msTime, double* row)
+            : myOrigin(origin), myDestinations(destinations), myVehicle(vehicle), myTime(msTime), myRow(row) {}
+        void run(FXWorkerThread* context) {
+            computeRow(static_cast<WorkerThread*>(context)->getRouter(), myOrigin, myDestinations, myVehicle, myTime, myRow);
+        }
+    private:
+        const E* const myOrigin;
+        const std::vector<const E*>& myDestinations;
+        const V* const myVehicle;
+        const SUMOTime myTime;
+        double* const myRow;
+    private:
+        /// @brief Invalidated assignment operator.
+        RowTask& operator=(const RowTask&) = delete;
+    };
+
+    /// @brief the pool for parallel row computation
+    FXWorkerThread::Pool myThreadPool;
+#endif
+
+private:
+    /// @brief the router for the sequential computation and the prototype for the workers
+    Router myRouter;
+
+private:
+    /// @brief Invalidated copy constructor
+    ManyToManyRouter(const ManyToManyRouter& s) = delete;
+
+    /// @brief Invalidated assignment operator
+    ManyToManyRouter& operator=(const ManyToManyRouter& s) = delete;
+};
+
+
+#endif
+
+/****************************************************************************/
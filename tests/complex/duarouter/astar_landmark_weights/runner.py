@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Routes trips with time dependent weights using dijkstra, A* and A* with
+landmarks and checks that all of them find the same routes. The weights of
+the first interval are much higher than the later ones, so landmark
+distances computed at the begin time would overestimate the travel times of
+the trips which all depart later.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import re
+import sys
+import random
+import subprocess
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+random.seed(42)
+devnull = open(os.devnull, 'w')
+subprocess.check_call([sumolib.checkBinary('netgenerate'), '--grid', '--grid.number', '6',
+                       '-o', 'input_net.net.xml'], stdout=devnull)
+net = sumolib.net.readNet('input_net.net.xml')
+edges = sorted([e.getID() for e in net.getEdges()])
+with open("input_weights.xml", "w") as weights:
+    print("<meandata>", file=weights)
+    print('    <interval begin="0" end="600">', file=weights)
+    for edge in edges:
+        print('        <edge id="%s" traveltime="%.2f"/>' % (edge, random.uniform(100, 300)), file=weights)
+    print('    </interval>', file=weights)
+    for begin in range(600, 4000, 200):
+        print('    <interval begin="%s" end="%s">' % (begin, begin + 200), file=weights)
+        for edge in edges:
+            print('        <edge id="%s" traveltime="%.2f"/>' % (edge, random.uniform(5, 60)), file=weights)
+        print('    </interval>', file=weights)
+    print("</meandata>", file=weights)
+with open("input_trips.xml", "w") as trips:
+    print("<routes>", file=trips)
+    for i in range(300):
+        source, dest = random.sample(edges, 2)
+        print('    <trip id="%s" depart="%s" from="%s" to="%s"/>' % (i, 600 + 5 * i, source, dest), file=trips)
+    print("</routes>", file=trips)
+with open("landmarks.txt", "w") as landmarks:
+    # the outermost edges in every direction
+    for key in (lambda e: e.getFromNode().getCoord()[0], lambda e: e.getFromNode().getCoord()[1]):
+        ordered = sorted(net.getEdges(), key=lambda e: (key(e), e.getID()))
+        print(ordered[0].getID(), file=landmarks)
+        print(ordered[-1].getID(), file=landmarks)
+
+
+def read(fileName):
+    """reads the file skipping the comments which contain the options"""
+    with open(fileName) as f:
+        return re.sub("<!--.*?-->", "", f.read(), flags=re.DOTALL)
+
+
+def route(name, options):
+    subprocess.check_call([sumolib.checkBinary('duarouter'), '-n', 'input_net.net.xml', '-r', 'input_trips.xml',
+                           '-w', 'input_weights.xml', '-o', 'routes_%s.rou.xml' % name,
+                           '--no-step-log', '--no-warnings'] + options, stdout=devnull)
+    return read('routes_%s.rou.xml' % name)
+
+
+dijkstra = route("dijkstra", ['--routing-algorithm', 'dijkstra'])
+astar = route("astar", ['--routing-algorithm', 'astar'])
+landmarks = route("landmarks", ['--routing-algorithm', 'astar', '--astar.landmark-distances', 'landmarks.txt'])
+print("astar routes identical to dijkstra:", astar == dijkstra)
+print("astar with landmarks routes identical to dijkstra:", landmarks == dijkstra)
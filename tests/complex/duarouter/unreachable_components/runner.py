@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Routes trips on a network with a two-way main street, a one-way dead end
+branching off it (reachable from the main street but not back) and a
+separate one-way island. The trips into the island and back from the dead
+end are rejected by the connected components before the router runs. The
+messages and the routes of the other trips must be the same as the ones the
+router gives on its own.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import sys
+import subprocess
+import xml.etree.ElementTree as ET
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+NODES = (("n1", 0, 0), ("n2", 100, 0), ("n3", 200, 0), ("n4", 300, 0), ("n5", 400, 0),
+         ("n6", 0, 200), ("n7", 100, 200), ("n8", 200, 200))
+EDGES = (("main1", "n1", "n2"), ("-main1", "n2", "n1"), ("main2", "n2", "n3"), ("-main2", "n3", "n2"),
+         # the dead end
+         ("exit", "n3", "n4"), ("tail", "n4", "n5"),
+         # the island
+         ("island1", "n6", "n7"), ("island2", "n7", "n8"))
+TRIPS = (("main1", "tail"), ("main1", "island2"), ("tail", "main1"), ("island1", "island2"), ("exit", "-main2"))
+
+with open("input_nodes.nod.xml", "w") as nodes:
+    print("<nodes>", file=nodes)
+    for node in NODES:
+        print('    <node id="%s" x="%s" y="%s"/>' % node, file=nodes)
+    print("</nodes>", file=nodes)
+with open("input_edges.edg.xml", "w") as edges:
+    print("<edges>", file=edges)
+    for edge in EDGES:
+        print('    <edge id="%s" from="%s" to="%s"/>' % edge, file=edges)
+    print("</edges>", file=edges)
+with open("input_trips.xml", "w") as trips:
+    print("<routes>", file=trips)
+    for i, (source, dest) in enumerate(TRIPS):
+        print('    <trip id="%s" depart="%s" from="%s" to="%s"/>' % (i, i, source, dest), file=trips)
+    print("</routes>", file=trips)
+
+devnull = open(os.devnull, 'w')
+subprocess.check_call([sumolib.checkBinary('netconvert'), '-n', 'input_nodes.nod.xml', '-e', 'input_edges.edg.xml',
+                       '--no-warnings', '-o', 'input_net.net.xml'], stdout=devnull)
+duarouter = subprocess.Popen([sumolib.checkBinary('duarouter'), '-n', 'input_net.net.xml', '-r', 'input_trips.xml',
+                              '-o', 'routes.rou.xml', '--ignore-errors', '--no-step-log'],
+                             stdout=devnull, stderr=subprocess.PIPE, universal_newlines=True)
+for line in duarouter.communicate()[1].splitlines():
+    print(line)
+for vehicle in ET.parse('routes.rou.xml').getroot().findall('vehicle'):
+    print("vehicle %s: %s" % (vehicle.get('id'), vehicle.find('route').get('edges')))
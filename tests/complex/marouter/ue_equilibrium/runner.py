@@ -0,0 +1,95 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Runs the user equilibrium assignment of marouter on two parallel routes
+with a known equilibrium.
+
+Both routes have one lane, priority -1 and 10m/s, so the travel time of an
+edge with length l and hourly flow f is l / 10 * (1 + 2 * f / 2600).
+The direct route A has 1000m, the detour B1 B2 1500m. With 2000 vehicles
+in one hour equal route times give
+1000 * (1 + fA / 1300) = 1500 * (1 + (2000 - fA) / 1300)
+and therefore fA = 1460 and fB = 540 at the equilibrium.
+The assignment is run once sequentially and once with routing threads.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import sys
+import subprocess
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+with open("input_nodes.nod.xml", "w") as nodes:
+    print("""<nodes>
+    <node id="o" x="-500" y="0"/>
+    <node id="a" x="0" y="0"/>
+    <node id="c" x="500" y="500"/>
+    <node id="b" x="1000" y="0"/>
+    <node id="d" x="1500" y="0"/>
+</nodes>""", file=nodes)
+with open("input_edges.edg.xml", "w") as edges:
+    print("""<edges>
+    <edge id="s" from="o" to="a" numLanes="1" speed="10" priority="-1" length="500"/>
+    <edge id="A" from="a" to="b" numLanes="1" speed="10" priority="-1" length="1000"/>
+    <edge id="B1" from="a" to="c" numLanes="1" speed="10" priority="-1" length="750"/>
+    <edge id="B2" from="c" to="b" numLanes="1" speed="10" priority="-1" length="750"/>
+    <edge id="t" from="b" to="d" numLanes="1" speed="10" priority="-1" length="500"/>
+</edges>""", file=edges)
+with open("input_taz.taz.xml", "w") as taz:
+    print("""<tazs>
+    <taz id="1">
+        <tazSource id="s" weight="1"/>
+    </taz>
+    <taz id="2">
+        <tazSink id="t" weight="1"/>
+    </taz>
+</tazs>""", file=taz)
+with open("input_od.fma", "w") as od:
+    print("""$VMR;D2
+* vehicle type
+   1
+* from to
+0.00 1.00
+* factor
+1.00
+*
+* number of districts
+2
+*
+          1           2
+*
+* district 1
+      0.00    2000.00
+* district 2
+      0.00       0.00""", file=od)
+
+devnull = open(os.devnull, 'w')
+subprocess.check_call([sumolib.checkBinary('netconvert'), '-n', 'input_nodes.nod.xml', '-e', 'input_edges.edg.xml',
+                       '-o', 'input_net.net.xml'], stdout=devnull)
+for threads in ("0", "4"):
+    routes = "routes_%s.rou.xml" % threads
+    subprocess.check_call([sumolib.checkBinary('marouter'), '-n', 'input_net.net.xml', '-d', 'input_taz.taz.xml',
+                           '-m', 'input_od.fma', '-o', routes, '--assignment-method', 'UE',
+                           '--routing-threads', threads], stdout=devnull)
+    print("routing threads", threads)
+    costs = []
+    # the order of the routes depends on which one was the last shortest path
+    for route in sorted(sumolib.xml.parse(routes, 'route'), key=lambda r: r.edges):
+        print("  %s: %.0f vehicles" % (route.edges, float(route.probability)))
+        costs.append(float(route.cost))
+    print("  equal route costs:", len(costs) == 2 and abs(costs[0] - costs[1]) < 0.01 * costs[0])
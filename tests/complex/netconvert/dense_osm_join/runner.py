@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Generates a large OpenStreetMap grid of dual carriageways. Every
+intersection consists of four nodes a few meters apart, so that each one
+forms a junction cluster. The network is imported with --junctions.join and
+the time of the joining phase is reported on its own.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import sys
+import math
+import re
+import subprocess
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+GRID = 80
+SPACING = 100.
+# half the distance between the carriageways, well below junctions.join-dist
+OFFSET = 4.
+LAT0 = 52.5
+LON0 = 13.4
+METERS_PER_DEGREE = 111320.
+
+
+def nodeID(i, j, corner):
+    return 1 + 4 * (j * GRID + i) + corner
+
+
+def writeOSM(fileName):
+    with open(fileName, "w") as osm:
+        print('<?xml version="1.0" encoding="UTF-8"?>', file=osm)
+        print('<osm version="0.6" generator="dense_osm_join">', file=osm)
+        lonScale = METERS_PER_DEGREE * math.cos(math.radians(LAT0))
+        for j in range(GRID):
+            for i in range(GRID):
+                # corners: 0 south-west, 1 south-east, 2 north-west, 3 north-east
+                for corner in range(4):
+                    x = i * SPACING + (OFFSET if corner % 2 else -OFFSET)
+                    y = j * SPACING + (OFFSET if corner >= 2 else -OFFSET)
+                    print('  <node id="%s" lat="%.7f" lon="%.7f"/>' % (
+                        nodeID(i, j, corner), LAT0 + y / METERS_PER_DEGREE, LON0 + x / lonScale), file=osm)
+        wayID = 1
+
+        def writeWay(wayID, nodes):
+            print('  <way id="%s">' % wayID, file=osm)
+            for n in nodes:
+                print('    <nd ref="%s"/>' % n, file=osm)
+            print('    <tag k="highway" v="secondary"/>', file=osm)
+            print('    <tag k="oneway" v="yes"/>', file=osm)
+            print('  </way>', file=osm)
+
+        for j in range(GRID):
+            east = []
+            west = []
+            for i in range(GRID):
+                east += [nodeID(i, j, 0), nodeID(i, j, 1)]
+                west += [nodeID(i, j, 2), nodeID(i, j, 3)]
+            writeWay(wayID, east)
+            writeWay(wayID + 1, reversed(west))
+            wayID += 2
+        for i in range(GRID):
+            north = []
+            south = []
+            for j in range(GRID):
+                north += [nodeID(i, j, 1), nodeID(i, j, 3)]
+                south += [nodeID(i, j, 0), nodeID(i, j, 2)]
+            writeWay(wayID, north)
+            writeWay(wayID + 1, reversed(south))
+            wayID += 2
+        print('</osm>', file=osm)
+
+
+writeOSM("input_osm.xml")
+output = subprocess.check_output([sumolib.checkBinary('netconvert'), '--osm-files', 'input_osm.xml',
+                                  '--junctions.join', '--no-turnarounds', '--no-warnings', '-v',
+                                  '-o', 'net.net.xml'], universal_newlines=True)
+joinTime = re.search(r"Joining junction clusters\.\.\. done \(([0-9]*)ms\)", output)
+print("join phase: %s ms" % (joinTime.group(1) if joinTime else "missing"))
+net = sumolib.net.readNet('net.net.xml')
+print("intersections:", GRID * GRID)
+print("every intersection joined:", len(net.getNodes()) == GRID * GRID)
@@ -0,0 +1,63 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Replaces the shape of a junction in a generated network and checks when
+netconvert keeps it with --junctions.keep-loaded-shapes.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import sys
+import subprocess
+import xml.etree.ElementTree as ET
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+JUNCTION = "B1"
+
+devnull = open(os.devnull, 'w')
+subprocess.check_call([sumolib.checkBinary('netgenerate'), '--grid', '--grid.number', '3',
+                       '-o', 'input_net.net.xml'], stdout=devnull)
+tree = ET.parse('input_net.net.xml')
+for junction in tree.getroot().iter('junction'):
+    if junction.get('id') == JUNCTION:
+        x = float(junction.get('x'))
+        y = float(junction.get('y'))
+        shape = " ".join(["%.2f,%.2f" % (x + dx, y + dy) for dx, dy in ((-4, -4), (4, -4), (4, 4), (-4, 4))])
+        junction.set('shape', shape)
+tree.write('modified.net.xml')
+
+
+def keptShape(*args):
+    netconvert = sumolib.checkBinary('netconvert')
+    subprocess.check_call([netconvert, '-s', 'modified.net.xml', '-o', 'output.net.xml', '--no-warnings'] +
+                          list(args), stdout=devnull)
+    for junction in ET.parse('output.net.xml').getroot().iter('junction'):
+        if junction.get('id') == JUNCTION:
+            return junction.get('shape') == shape
+
+
+print("without option kept:", keptShape())
+print("with option kept:", keptShape('--junctions.keep-loaded-shapes'))
+print("with changed corner detail kept:",
+      keptShape('--junctions.keep-loaded-shapes', '--junctions.corner-detail', '5'))
+print("with changed rectangular lane cut kept:",
+      keptShape('--junctions.keep-loaded-shapes', '--rectangular-lane-cut'))
+print("with changed default radius kept:",
+      keptShape('--junctions.keep-loaded-shapes', '--default.junctions.radius', '8'))
+print("with removed edge kept:",
+      keptShape('--junctions.keep-loaded-shapes', '--remove-edges.explicit', 'A1B1'))
@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Imports an OpenDRIVE network with and without --opendrive.curve-tolerance and
+checks that the simplified edge shapes have fewer points but stay close to the
+full ones.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import sys
+import subprocess
+import xml.etree.ElementTree as ET
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', "tools"))
+import sumolib  # noqa
+from sumolib.geomhelper import distancePointToPolygon  # noqa
+
+TOLERANCE = 0.1
+# the lane offsets are applied after the simplification which enlarges the deviation in curves
+MAX_DEVIATION = 2 * TOLERANCE
+
+
+def readShapes(tolerance):
+    prefix = "plain_%s" % tolerance
+    subprocess.check_call([sumolib.checkBinary('netconvert'), '--opendrive-files', 'opendrive.xodr',
+                           '--opendrive.curve-tolerance', str(tolerance), '--no-warnings',
+                           '--plain-output-prefix', prefix], stdout=open(os.devnull, 'w'))
+    shapes = {}
+    for edge in ET.parse(prefix + '.edg.xml').getroot().iter('edge'):
+        shape = edge.get('shape', "")
+        shapes[edge.get('id')] = [tuple(map(float, p.split(","))) for p in shape.split()]
+    return shapes
+
+
+full = readShapes(0)
+simplified = readShapes(TOLERANCE)
+print("edges identical:", sorted(full.keys()) == sorted(simplified.keys()))
+print("fewer shape points:", sum(map(len, simplified.values())) < sum(map(len, full.values())))
+deviation = max([distancePointToPolygon(p[:2], [q[:2] for q in simplified[e]])
+                 for e in full if len(simplified.get(e, [])) > 1 for p in full[e]])
+print("deviation below %s:" % MAX_DEVIATION, deviation <= MAX_DEVIATION)
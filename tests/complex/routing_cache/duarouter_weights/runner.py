@@ -0,0 +1,65 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Routes many repeated origin-destination pairs with time dependent weights
+once with and once without the routing cache and checks that the routes are
+identical. The weight intervals are neither aligned to the default weight
+period nor long compared to the trips, so many trips cross a weight change.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import re
+import sys
+import random
+import subprocess
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+random.seed(42)
+devnull = open(os.devnull, 'w')
+subprocess.check_call([sumolib.checkBinary('netgenerate'), '--grid', '--grid.number', '4',
+                       '-o', 'input_net.net.xml'], stdout=devnull)
+edges = [e.getID() for e in sumolib.net.readNet('input_net.net.xml').getEdges()]
+with open("input_weights.xml", "w") as weights:
+    print("<meandata>", file=weights)
+    for begin in range(50, 3000, 170):
+        print('    <interval begin="%s" end="%s">' % (begin, begin + 170), file=weights)
+        for edge in edges:
+            print('        <edge id="%s" traveltime="%.2f"/>' % (edge, random.uniform(5, 60)), file=weights)
+        print('    </interval>', file=weights)
+    print("</meandata>", file=weights)
+with open("input_trips.xml", "w") as trips:
+    print("<routes>", file=trips)
+    pairs = [random.sample(edges, 2) for i in range(5)]
+    for i in range(1000):
+        source, dest = random.choice(pairs)
+        print('    <trip id="%s" depart="%s" from="%s" to="%s"/>' % (i, 3 * i, source, dest), file=trips)
+    print("</routes>", file=trips)
+
+
+def read(fileName):
+    """reads the file skipping the comments which contain the options"""
+    with open(fileName) as f:
+        return re.sub("<!--.*?-->", "", f.read(), flags=re.DOTALL)
+
+
+for cache in ("false", "true"):
+    subprocess.check_call([sumolib.checkBinary('duarouter'), '-n', 'input_net.net.xml', '-r', 'input_trips.xml',
+                           '-w', 'input_weights.xml', '-o', 'routes_%s.rou.xml' % cache,
+                           '--routing-cache', cache, '--no-step-log'], stdout=devnull)
+print("routes", "identical" if read("routes_false.rou.xml") == read("routes_true.rou.xml") else "differ")
@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Closes an edge of the fastest route with a rerouter while the vehicles are
+routed by the rerouting device using the routing cache. The cached routes are
+kept much longer than the simulation runs, so only the permission change can
+invalidate them. The vehicles departing after the closing must avoid the edge
+and the routes must be the same as without the cache.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import sys
+import subprocess
+import xml.etree.ElementTree as ET
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+CLOSING_TIME = 200
+devnull = open(os.devnull, 'w')
+subprocess.check_call([sumolib.checkBinary('netgenerate'), '--grid', '--grid.number', '5',
+                       '-o', 'input_net.net.xml'], stdout=devnull)
+net = sumolib.net.readNet('input_net.net.xml')
+edges = sorted(net.getEdges(), key=lambda e: e.getID())
+source = edges[0]
+start = source.getToNode().getCoord()
+dest = max(edges, key=lambda e: abs(e.getFromNode().getCoord()[0] - start[0]) +
+           abs(e.getFromNode().getCoord()[1] - start[1]))
+with open("input_trips.xml", "w") as trips:
+    print("<routes>", file=trips)
+    for i in range(100):
+        print('    <trip id="%s" depart="%s" from="%s" to="%s"/>' % (
+            i, 5 * i, source.getID(), dest.getID()), file=trips)
+    print("</routes>", file=trips)
+
+
+def run(cache, additional=None):
+    output = "vehroutes_%s.xml" % cache
+    args = [sumolib.checkBinary('sumo'), '-n', 'input_net.net.xml', '-r', 'input_trips.xml',
+            '--device.rerouting.probability', '1', '--device.rerouting.period', '30',
+            '--device.rerouting.cache', cache, '--device.rerouting.cache.period', '100000',
+            '--vehroute-output', output, '--vehroute-output.last-route',
+            '--no-step-log', '--no-warnings']
+    if additional is not None:
+        args += ['-a', additional]
+    subprocess.check_call(args, stdout=devnull)
+    routes = {}
+    for vehicle in ET.parse(output).getroot().iter('vehicle'):
+        routes[vehicle.get('id')] = (float(vehicle.get('depart')),
+                                     vehicle.find('route').get('edges').split())
+    return routes
+
+
+# close an inner edge of the route which is chosen without the closing
+route = run("false")["0"][1]
+closed = route[len(route) // 2]
+# the rerouter is triggered on the destination, so only the closing matters
+with open("input_additional.add.xml", "w") as add:
+    print("""<additional>
+    <rerouter id="closing" edges="%s">
+        <interval begin="%s" end="10000">
+            <closingReroute id="%s" disallow="passenger"/>
+        </interval>
+    </rerouter>
+</additional>""" % (dest.getID(), CLOSING_TIME, closed), file=add)
+uncached = run("false", "input_additional.add.xml")
+cached = run("true", "input_additional.add.xml")
+print("routes", "identical" if uncached == cached else "differ")
+print("closed edge avoided:", all(closed not in r for depart, r in cached.values()
+                                   if depart >= CLOSING_TIME))
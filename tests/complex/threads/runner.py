@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Runs an application once sequentially and once with several threads and
+checks that the given outputs are identical (apart from the header comments).
+Optionally generates a grid network and random trips as input first.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import re
+import sys
+import subprocess
+import difflib
+import optparse
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', "tools"))
+import sumolib  # noqa
+
+optParser = optparse.OptionParser()
+optParser.add_option("--app", help="the application to run")
+optParser.add_option("--thread-option", default="threads", help="the option setting the number of threads")
+optParser.add_option("--sequential", default="1", help="the number of threads for the reference run")
+optParser.add_option("--parallel", default="4", help="the number of threads for the parallel run")
+optParser.add_option("--output", action="append", default=[],
+                     help="an output option whose file is compared (may be given multiple times)")
+optParser.add_option("--grid", type="int", help="generate a grid network with the given size as input_net.net.xml")
+optParser.add_option("--rand", type="int",
+                     help="generate a random network with the given number of iterations as input_net.net.xml")
+optParser.add_option("--trips", type="int", help="generate random trips with the given end time as input_trips.xml")
+options, args = optParser.parse_args()
+
+devnull = open(os.devnull, 'w')
+if options.grid:
+    subprocess.check_call([sumolib.checkBinary('netgenerate'), '--grid', '--grid.number', str(options.grid),
+                           '-o', 'input_net.net.xml'], stdout=devnull)
+if options.rand:
+    subprocess.check_call([sumolib.checkBinary('netgenerate'), '--rand', '--rand.iterations', str(options.rand),
+                           '--seed', '42', '-o', 'input_net.net.xml'], stdout=devnull)
+if options.trips:
+    subprocess.check_call([sys.executable,
+                           os.path.join(os.path.dirname(sumolib.__file__), '..', 'randomTrips.py'),
+                           '-n', 'input_net.net.xml', '-o', 'input_trips.xml', '--seed', '42',
+                           '-e', str(options.trips), '-p', '1'], stdout=devnull)
+
+
+def outputFile(option, threads):
+    return "%s_%s.xml" % (option.replace(".", "_"), threads)
+
+
+def readFiltered(fileName):
+    """reads the file skipping the comments which contain the options"""
+    with open(fileName) as f:
+        content = re.sub("<!--.*?-->", "", f.read(), flags=re.DOTALL)
+    return [l + "\n" for l in content.splitlines() if l.strip() != ""]
+
+
+app = sumolib.checkBinary(options.app)
+for threads in (options.sequential, options.parallel):
+    cmd = [app] + args + ['--%s' % options.thread_option, threads]
+    for option in options.output:
+        cmd += ['--%s' % option, outputFile(option, threads)]
+    if subprocess.call(cmd, stdout=devnull) != 0:
+        print("%s failed with --%s %s" % (options.app, options.thread_option, threads), file=sys.stderr)
+for option in options.output:
+    seq = outputFile(option, options.sequential)
+    par = outputFile(option, options.parallel)
+    if not os.path.exists(seq) or not os.path.exists(par):
+        print("%s: missing" % option)
+        continue
+    diff = list(difflib.unified_diff(readFiltered(seq), readFiltered(par), seq, par))
+    if diff:
+        print("%s: differs" % option)
+        sys.stderr.writelines(diff)
+    else:
+        print("%s: identical" % option)
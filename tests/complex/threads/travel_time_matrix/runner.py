@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Compares the travel time matrix of libsumo (computed with a thread pool)
+with the travel times of the single routes and checks that repeated
+queries reuse the router without changing the result.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import sys
+import subprocess
+SUMO_HOME = os.path.join(os.path.dirname(__file__), "..", "..", "..", "..")
+sys.path += [os.path.join(SUMO_HOME, "tools"), os.path.join(SUMO_HOME, "bin")]
+import libsumo  # noqa
+import sumolib  # noqa
+
+ROUTING_MODE_AGGREGATED = 1
+
+subprocess.check_call([sumolib.checkBinary('netgenerate'), '--grid', '--grid.number', '5',
+                       '-o', 'input_net.net.xml'], stdout=open(os.devnull, 'w'))
+libsumo.start([sumolib.checkBinary('sumo'), "-n", "input_net.net.xml", "--no-step-log",
+               "--device.rerouting.probability", "1", "--device.rerouting.threads", "4"])
+edges = sorted([e for e in libsumo.edge.getIDList() if e[0] != ":"])
+# a vehicle with a routing device initializes the aggregated edge weights
+libsumo.route.add("r0", [edges[0]])
+libsumo.vehicle.add("v0", "r0")
+libsumo.simulationStep()
+origins = edges[::3]
+destinations = edges[1::2]
+for mode, name in ((0, "default"), (ROUTING_MODE_AGGREGATED, "aggregated")):
+    matrix = list(libsumo.simulation.findTravelTimeMatrix(origins, destinations, "", -1, mode))
+    mismatches = 0
+    for i, orig in enumerate(origins):
+        for j, dest in enumerate(destinations):
+            expected = libsumo.simulation.findRoute(orig, dest, "", -1, mode).travelTime
+            if abs(matrix[i * len(destinations) + j] - expected) > 1e-6:
+                mismatches += 1
+    print("%s: %s entries, %s differ from findRoute" % (name, len(matrix), mismatches))
+    again = list(libsumo.simulation.findTravelTimeMatrix(origins, destinations, "", -1, mode))
+    print("%s: repeated query %s" % (name, "identical" if again == matrix else "differs"))
+libsumo.close()
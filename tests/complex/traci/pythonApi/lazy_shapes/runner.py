@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2008-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+
+from __future__ import print_function
+from __future__ import absolute_import
+import os
+import subprocess
+import sys
+sys.path.append(os.path.join(
+    os.path.dirname(sys.argv[0]), "..", "..", "..", "..", "..", "tools"))
+import traci  # noqa
+import traci.constants as tc  # noqa
+import sumolib  # noqa
+
+sumoBinary = sumolib.checkBinary('sumo')
+
+PORT = sumolib.miscutils.getFreeSocketPort()
+sumoProcess = subprocess.Popen(
+    "%s -c sumo.sumocfg --additional-files input_additional.add.xml --additional-files.lazy-shapes --remote-port %s" %
+    (sumoBinary, PORT), shell=True, stdout=sys.stdout)
+traci.init(PORT)
+traci.simulationStep()
+# the id lists include the shapes which were not built yet
+print("polygons", sorted(traci.polygon.getIDList()))
+print("polygon count", traci.polygon.getIDCount())
+print("pois", sorted(traci.poi.getIDList()))
+print("poi count", traci.poi.getIDCount())
+# the getters build the shapes
+print("near shape", traci.polygon.getShape("near"))
+print("near type", traci.polygon.getType("near"))
+print("near color", traci.polygon.getColor("near"))
+print("near filled", traci.polygon.getFilled("near"))
+print("poiNear position", traci.poi.getPosition("poiNear"))
+print("poiNear type", traci.poi.getType("poiNear"))
+# parameters from the input and set via TraCI
+print("withParam foo", traci.polygon.getParameter("withParam", "foo"))
+print("poiParam foo", traci.poi.getParameter("poiParam", "foo"))
+traci.polygon.setParameter("far", "key", "value")
+print("far key", traci.polygon.getParameter("far", "key"))
+print("far shape", traci.polygon.getShape("far"))
+# removing shapes which were not built
+traci.polygon.remove("removed")
+traci.poi.remove("poiFar")
+print("polygons after removal", sorted(traci.polygon.getIDList()))
+print("pois after removal", sorted(traci.poi.getIDList()))
+# context subscriptions find the shapes which were not built yet
+traci.junction.subscribeContext("0", tc.CMD_GET_POLYGON_VARIABLE, 100, [tc.VAR_TYPE])
+traci.junction.subscribeContext("m1", tc.CMD_GET_POI_VARIABLE, 50, [tc.VAR_TYPE])
+for step in range(2):
+    traci.simulationStep()
+    print("polygons around 0", sorted(traci.junction.getContextSubscriptionResults("0").items()))
+    print("pois around m1", sorted(traci.junction.getContextSubscriptionResults("m1").items()))
+traci.close()
+sumoProcess.wait()
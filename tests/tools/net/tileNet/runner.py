@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Builds a grid network once directly and once in 2x2 tiles with tileNet.py and
+compares the results. The junction pairs straddling the tile border are joined
+into traffic lights spanning two tiles.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import sys
+import subprocess
+import xml.etree.ElementTree as ET
+if 'SUMO_HOME' in os.environ:
+    sys.path.append(os.path.join(os.environ['SUMO_HOME'], 'tools'))
+else:
+    sys.exit("please declare environment variable 'SUMO_HOME'")
+import sumolib  # noqa
+
+# the columns 4 and 5 are only 10m apart and lie on both sides of the tile border at x=450
+COLUMNS = [0, 100, 200, 300, 445, 455, 600, 700, 800, 900]
+ROWS = [100 * i for i in range(10)]
+
+with open("input_nodes.nod.xml", "w") as nodes:
+    print("<nodes>", file=nodes)
+    for i, x in enumerate(COLUMNS):
+        for j, y in enumerate(ROWS):
+            nodeType = "traffic_light" if 0 < j < len(ROWS) - 1 and x in (445, 455) else "priority"
+            print('    <node id="%s_%s" x="%s" y="%s" type="%s"/>' % (i, j, x, y, nodeType), file=nodes)
+    print("</nodes>", file=nodes)
+with open("input_edges.edg.xml", "w") as edges:
+    print("<edges>", file=edges)
+    for i in range(len(COLUMNS)):
+        for j in range(len(ROWS)):
+            for ni, nj in ((i + 1, j), (i, j + 1)):
+                if ni < len(COLUMNS) and nj < len(ROWS):
+                    for f, t in (((i, j), (ni, nj)), ((ni, nj), (i, j))):
+                        print('    <edge id="%s_%s_%s_%s" from="%s_%s" to="%s_%s" numLanes="2"/>' %
+                              (f + t + f + t), file=edges)
+    print("</edges>", file=edges)
+with open("tiles.netccfg", "w") as cfg:
+    print("""<configuration>
+    <input>
+        <node-files value="input_nodes.nod.xml"/>
+        <edge-files value="input_edges.edg.xml"/>
+    </input>
+    <tls_building>
+        <tls.join value="true"/>
+    </tls_building>
+    <report>
+        <no-warnings value="true"/>
+    </report>
+</configuration>""", file=cfg)
+
+devnull = open(os.devnull, "w")
+netconvert = sumolib.checkBinary("netconvert")
+subprocess.check_call([netconvert, "-c", "tiles.netccfg", "--offset.disable-normalization",
+                       "-o", "direct.net.xml"], stdout=devnull)
+subprocess.check_call([sys.executable, os.path.join(os.path.dirname(sumolib.__file__), "..", "net", "tileNet.py"),
+                       "-c", "tiles.netccfg", "-b", "0,0,900,900", "--overlap", "300", "--threads", "2",
+                       "-o", "tiled.net.xml"], stdout=devnull)
+
+
+def readNet(netFile):
+    """ Returns the serialized elements per tag using the controlled junctions as traffic light ids """
+    root = ET.parse(netFile).getroot()
+    toNode = dict([(e.get("id"), e.get("to")) for e in root.iter("edge")])
+    controlled = {}
+    for conn in root.iter("connection"):
+        if conn.get("tl") is not None and not conn.get("from").startswith(":"):
+            controlled.setdefault(conn.get("tl"), set()).add(toNode[conn.get("from")])
+    tlsIDs = dict([(tls, "+".join(sorted(nodes))) for tls, nodes in controlled.items()])
+    result = {}
+    for elem in root:
+        if elem.tag == "tlLogic":
+            elem.set("id", tlsIDs[elem.get("id")])
+        elif elem.tag == "connection" and elem.get("tl") is not None:
+            elem.set("tl", tlsIDs[elem.get("tl")])
+        elif elem.tag == "location":
+            continue
+        elem.tail = None
+        result.setdefault(elem.tag, set()).add(ET.tostring(elem))
+    return result
+
+
+direct = readNet("direct.net.xml")
+tiled = readNet("tiled.net.xml")
+print("joined traffic lights: %s" % len([tls for tls in direct["tlLogic"] if b"+" in tls]))
+for tag in ("edge", "tlLogic", "junction", "connection"):
+    if direct[tag] == tiled[tag]:
+        print("%s: identical" % tag)
+    else:
+        print("%s: %s missing, %s extra" % (tag, len(direct[tag] - tiled[tag]), len(tiled[tag] - direct[tag])))
@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    mesoScaling.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Measures the scaling of the parallel mesoscopic simulation (option --meso-threads)
+on a generated grid network and checks that the outputs do not depend on the
+number of threads (exits with an error if they do).
+"""
+from __future__ import print_function
+from __future__ import absolute_import
+import os
+import sys
+import subprocess
+import time
+import re
+from optparse import OptionParser
+
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+import sumolib  # noqa
+
+
+def get_options(args=None):
+    optParser = OptionParser()
+    optParser.add_option("-d", "--directory", default="mesoScaling",
+                         help="directory for the generated inputs and outputs")
+    optParser.add_option("-g", "--grid-number", type="int", default=100,
+                         help="number of junctions in each direction of the grid")
+    optParser.add_option("-p", "--period", type="float", default=0.05,
+                         help="insertion period for the generated trips")
+    optParser.add_option("-e", "--end", type="int", default=3600,
+                         help="end of the demand generation and the simulation")
+    optParser.add_option("-t", "--threads", default="0,1,2,4,8,16,32",
+                         help="comma separated list of thread numbers to measure")
+    optParser.add_option("-r", "--repeat", type="int", default=1,
+                         help="number of runs per thread number (the fastest is reported)")
+    options, _ = optParser.parse_args(args=args)
+    options.threads = [int(t) for t in options.threads.split(",")]
+    return options
+
+
+def sameOutput(file1, file2):
+    """compares the files ignoring the header comments (which contain the date and the options)"""
+    contents = []
+    for fileName in (file1, file2):
+        with open(fileName) as f:
+            contents.append(re.sub("<!--.*?-->", "", f.read(), flags=re.DOTALL))
+    return contents[0] == contents[1]
+
+
+def main(options):
+    if not os.path.exists(options.directory):
+        os.makedirs(options.directory)
+    net = os.path.join(options.directory, "grid.net.xml")
+    trips = os.path.join(options.directory, "trips.xml")
+    if not os.path.exists(net):
+        subprocess.check_call([sumolib.checkBinary("netgenerate"), "--grid",
+                               "--grid.number", str(options.grid_number), "-o", net])
+    if not os.path.exists(trips):
+        subprocess.check_call([sys.executable, os.path.join(os.path.dirname(__file__), "..", "randomTrips.py"),
+                               "-n", net, "-o", trips, "-e", str(options.end), "-p", str(options.period)])
+    sumo = sumolib.checkBinary("sumo")
+    results = []
+    reference = None
+    differing = []
+    for threads in options.threads:
+        tripinfo = os.path.join(options.directory, "tripinfo_%s.xml" % threads)
+        best = None
+        for _ in range(options.repeat):
+            start = time.time()
+            subprocess.check_call([sumo, "-n", net, "-r", trips, "--mesosim", "--end", str(options.end),
+                                   "--meso-threads", str(threads), "--no-step-log", "--no-warnings",
+                                   "--tripinfo-output", tripinfo])
+            duration = time.time() - start
+            best = duration if best is None else min(best, duration)
+        if threads > 0:
+            if reference is None:
+                reference = tripinfo
+            elif not sameOutput(reference, tripinfo):
+                print("Error: output for %s threads differs from %s." % (threads, reference), file=sys.stderr)
+                differing.append(threads)
+        results.append((threads, best))
+    baseline = results[0][1]
+    print("threads  seconds  speedup")
+    for threads, duration in results:
+        print("%7s  %7.2f  %7.2f" % (threads, duration, baseline / duration))
+    return 1 if differing else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(get_options()))
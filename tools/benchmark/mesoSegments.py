@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    mesoSegments.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Micro benchmark for the mesoscopic segment handling. Short multi-lane segments
+with multiple queues and junction control maximize the number of segment
+changes (and thus follower queue and link lookups) per vehicle.
+
+Only the time of the meso phase of the simulation step is measured (using the
+profiling-output) and divided by the number of segment changes, which is
+counted in a separate run with edge based output. With --perf the cache misses
+of the whole simulation per segment change are reported as well (requires the
+linux perf tool).
+"""
+from __future__ import print_function
+from __future__ import absolute_import
+import os
+import sys
+import subprocess
+import xml.etree.ElementTree as ET
+from optparse import OptionParser
+
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+import sumolib  # noqa
+
+
+def get_options(args=None):
+    optParser = OptionParser()
+    optParser.add_option("-d", "--directory", default="mesoSegments",
+                         help="directory for the generated inputs")
+    optParser.add_option("-g", "--grid-number", type="int", default=30,
+                         help="number of junctions in each direction of the grid")
+    optParser.add_option("-l", "--lanes", type="int", default=3,
+                         help="number of lanes per edge")
+    optParser.add_option("-p", "--period", type="float", default=0.1,
+                         help="insertion period for the generated trips")
+    optParser.add_option("-e", "--end", type="int", default=3600,
+                         help="end of the demand generation and the simulation")
+    optParser.add_option("-s", "--segment-lengths", default="98,20,5",
+                         help="comma separated list of segment lengths to measure")
+    optParser.add_option("-r", "--repeat", type="int", default=3,
+                         help="number of runs per configuration (the fastest is reported)")
+    optParser.add_option("--perf", action="store_true", default=False,
+                         help="count the cache misses using 'perf stat'")
+    return optParser.parse_args(args=args)[0]
+
+
+def countSegmentChanges(sumoArgs, net, length, directory):
+    """runs the simulation with edge based output and sums up the segments entered"""
+    add = os.path.join(directory, "edgeData.add.xml")
+    output = os.path.join(directory, "edgeData.xml")
+    with open(add, "w") as f:
+        print('<additional><edgeData id="count" file="%s"/></additional>' % os.path.abspath(output), file=f)
+    subprocess.check_call(sumoArgs + ["-a", add])
+    segments = {}
+    for edge in sumolib.net.readNet(net).getEdges():
+        segments[edge.getID()] = max(1, int(edge.getLength() / float(length) + 0.5))
+    changes = 0
+    for edge in ET.parse(output).getroot().iter("edge"):
+        # departing vehicles change the segment only after their first one
+        departed = int(float(edge.get("departed", 0)))
+        entered = int(float(edge.get("entered", 0)))
+        changes += (entered + departed) * segments.get(edge.get("id"), 1) - departed
+    return changes
+
+
+def mesoMillis(sumoArgs, directory):
+    """runs the simulation and returns the time spent in the meso phase"""
+    output = os.path.join(directory, "profiling.xml")
+    subprocess.check_call(sumoArgs + ["--profiling-output", output])
+    return sum([float(interval.get("meso")) for interval in ET.parse(output).getroot().iter("interval")])
+
+
+def cacheMisses(sumoArgs):
+    """runs the simulation with perf and returns the number of cache misses"""
+    perf = subprocess.Popen(["perf", "stat", "-x", ",", "-e", "cache-misses"] + sumoArgs,
+                            stderr=subprocess.PIPE, universal_newlines=True)
+    for line in perf.communicate()[1].splitlines():
+        fields = line.split(",")
+        if len(fields) > 2 and fields[2].startswith("cache-misses"):
+            return int(fields[0])
+    return 0
+
+
+def main(options):
+    if not os.path.exists(options.directory):
+        os.makedirs(options.directory)
+    net = os.path.join(options.directory, "grid.net.xml")
+    trips = os.path.join(options.directory, "trips.xml")
+    if not os.path.exists(net):
+        subprocess.check_call([sumolib.checkBinary("netgenerate"), "--grid",
+                               "--grid.number", str(options.grid_number),
+                               "--default.lanenumber", str(options.lanes), "-o", net])
+    if not os.path.exists(trips):
+        subprocess.check_call([sys.executable, os.path.join(os.path.dirname(__file__), "..", "randomTrips.py"),
+                               "-n", net, "-o", trips, "-e", str(options.end), "-p", str(options.period)])
+    sumo = sumolib.checkBinary("sumo")
+    header = "segment length  junction control  meso ms  segment changes  ns per change"
+    print(header + ("  cache misses per change" if options.perf else ""))
+    for length in options.segment_lengths.split(","):
+        for junctionControl in ("false", "true"):
+            sumoArgs = [sumo, "-n", net, "-r", trips, "--mesosim", "--end", str(options.end),
+                        "--meso-edgelength", length, "--meso-multi-queue",
+                        "--meso-junction-control", junctionControl,
+                        "--no-step-log", "--no-warnings"]
+            changes = countSegmentChanges(sumoArgs, net, length, options.directory)
+            best = min([mesoMillis(sumoArgs, options.directory) for _ in range(options.repeat)])
+            line = "%14s  %16s  %7.0f  %15s  %13.1f" % (length, junctionControl, best, changes,
+                                                       1e6 * best / max(changes, 1))
+            if options.perf:
+                line += "  %24.2f" % (float(cacheMisses(sumoArgs)) / max(changes, 1))
+            print(line)
+
+
+if __name__ == "__main__":
+    main(get_options())
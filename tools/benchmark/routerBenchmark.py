@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    routerBenchmark.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Micro benchmark for the duarouter shortest path algorithms. Random trips on the
+networks of the duarouter tests (and a generated grid) are routed with each
+algorithm. If a second duarouter binary (e.g. a build of an older revision) is
+given, its timings are reported as well and the resulting routes are compared.
+"""
+from __future__ import print_function
+from __future__ import absolute_import
+import os
+import sys
+import subprocess
+import time
+from optparse import OptionParser
+
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+import sumolib  # noqa
+
+TEST_DIR = os.path.join(os.path.dirname(__file__), "..", "..", "tests", "duarouter")
+
+
+def get_options(args=None):
+    optParser = OptionParser()
+    optParser.add_option("-d", "--directory", default="routerBenchmark",
+                         help="directory for the generated inputs and outputs")
+    optParser.add_option("-n", "--net-files",
+                         default=",".join([os.path.join(TEST_DIR, "input_net.net.xml"),
+                                           os.path.join(TEST_DIR, "input_net2.net.xml")]),
+                         help="comma separated list of networks to route on")
+    optParser.add_option("-g", "--grid-number", type="int", default=100,
+                         help="number of junctions in each direction of the additional grid (0 disables it)")
+    optParser.add_option("-t", "--trips", type="int", default=20000,
+                         help="number of trips per network")
+    optParser.add_option("-a", "--algorithms", default="dijkstra,astar",
+                         help="comma separated list of routing algorithms to measure")
+    optParser.add_option("-b", "--baseline",
+                         help="duarouter binary to compare against")
+    optParser.add_option("-r", "--repeat", type="int", default=3,
+                         help="number of runs per configuration (the fastest is reported)")
+    return optParser.parse_args(args=args)[0]
+
+
+def run(binary, net, trips, algorithm, output, repeat):
+    best = None
+    for _ in range(repeat):
+        start = time.time()
+        subprocess.check_call([binary, "-n", net, "-r", trips, "-o", output,
+                               "--routing-algorithm", algorithm, "--ignore-errors",
+                               "--no-step-log", "--no-warnings"])
+        duration = time.time() - start
+        best = duration if best is None else min(best, duration)
+    return best
+
+
+def routes(output):
+    # skip the header comment which contains the options and the date
+    with open(output) as f:
+        content = f.read()
+    return content[content.find("<routes"):]
+
+
+def main(options):
+    if not os.path.exists(options.directory):
+        os.makedirs(options.directory)
+    nets = [n for n in options.net_files.split(",") if n]
+    if options.grid_number > 0:
+        grid = os.path.join(options.directory, "grid.net.xml")
+        if not os.path.exists(grid):
+            subprocess.check_call([sumolib.checkBinary("netgenerate"), "--grid",
+                                   "--grid.number", str(options.grid_number), "-o", grid])
+        nets.append(grid)
+    duarouter = sumolib.checkBinary("duarouter")
+    print("%-20s %-10s %9s %9s %s" % ("net", "algorithm", "seconds", "baseline", "routes"))
+    for net in nets:
+        name = os.path.basename(net).replace(".net.xml", "")
+        trips = os.path.join(options.directory, name + ".trips.xml")
+        if not os.path.exists(trips):
+            subprocess.check_call([sys.executable, os.path.join(os.path.dirname(__file__), "..", "randomTrips.py"),
+                                   "-n", net, "-o", trips, "-e", str(options.trips), "-p", "1",
+                                   "--min-distance", "0"])
+        for algorithm in options.algorithms.split(","):
+            output = os.path.join(options.directory, "%s_%s.rou.xml" % (name, algorithm))
+            duration = run(duarouter, net, trips, algorithm, output, options.repeat)
+            baseline = ""
+            same = ""
+            if options.baseline:
+                baseOutput = os.path.join(options.directory, "%s_%s_baseline.rou.xml" % (name, algorithm))
+                baseline = "%9.2f" % run(options.baseline, net, trips, algorithm, baseOutput, options.repeat)
+                same = "identical" if routes(output) == routes(baseOutput) else "DIFFERENT"
+            print("%-20s %-10s %9.2f %9s %s" % (name, algorithm, duration, baseline, same))
+
+
+if __name__ == "__main__":
+    main(get_options())
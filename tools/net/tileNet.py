@@ -0,0 +1,287 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    tileNet.py
+# @author  agent
+# @date    2026-10-18
+# @version $Id$
+
+"""
+Builds a network in spatial tiles and stitches the results.
+
+The input is given as a netconvert configuration. Every tile is built by a
+separate netconvert call (up to --threads of them in parallel) which only keeps
+the edges within the tile boundary grown by the overlap. The tile networks are
+then streamed into the final network without loading them completely: every
+junction (together with its internal edges) is taken from the tile containing
+it, every edge (together with its connections) from the tile which provides its
+from-node and every traffic light from the tile which provides the first of its
+controlled junctions. Thus memory is only needed for a single tile at a time.
+
+Node and edge ids stay unchanged as long as the overlap is larger than the
+longest edge and the distances used for joining junctions and guessing ramps or
+traffic lights, because all tiles then see the same neighborhood at the tile
+borders. Joined traffic lights are numbered per netconvert call, so they get
+the id of their first controlled junction with the prefix of the joined id.
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+import sys
+import os
+import re
+import subprocess
+import optparse
+import tempfile
+import shutil
+import xml.etree.ElementTree as ET
+from xml.sax.saxutils import quoteattr
+sys.path.append(os.path.dirname(os.path.dirname(os.path.realpath(__file__))))
+import sumolib  # noqa
+
+# the groups of elements in the order of a network written by netconvert
+GROUPS = ("type", "edge", "tlLogic", "junction", "connection")
+JOINED_TLS = re.compile("^(joined[SG]?)_[0-9]+$")
+
+
+def parseArgs():
+    USAGE = "Usage: " + sys.argv[0] + " -c <netconvert config> -b <xmin,ymin,xmax,ymax> [options]"
+    optParser = optparse.OptionParser(usage=USAGE)
+    optParser.add_option("-c", "--config", help="netconvert configuration describing the input")
+    optParser.add_option("-o", "--output-file", default="net.net.xml", help="the stitched network")
+    optParser.add_option("-b", "--boundary", help="the boundary of the region to split into tiles")
+    optParser.add_option("--geo", action="store_true", default=False,
+                         help="the boundary and the overlap are given in geo coordinates (needs pyproj)")
+    optParser.add_option("-t", "--tiles", default="2,2", help="the number of tiles in x and y direction")
+    optParser.add_option("--overlap", type="float",
+                         help="the distance by which every tile is grown (default 500m or 0.005 degrees)")
+    optParser.add_option("--threads", type="int", default=1, help="the number of parallel netconvert calls")
+    optParser.add_option("--tmp-dir", help="keep the tile files in the given directory")
+    options, args = optParser.parse_args()
+    if options.config is None or options.boundary is None:
+        sys.exit(USAGE)
+    options.boundary = [float(v) for v in options.boundary.split(",")]
+    options.tiles = [int(v) for v in options.tiles.split(",")]
+    if options.overlap is None:
+        options.overlap = 0.005 if options.geo else 500.
+    options.extra = args
+    options.proj = None
+    if options.geo:
+        projectBoundary(options)
+    return options
+
+
+def projectBoundary(options):
+    """ Converts the boundary and the overlap into the UTM zone of the boundary center """
+    import pyproj
+    lonMin, latMin, lonMax, latMax = options.boundary
+    lon = (lonMin + lonMax) / 2
+    lat = (latMin + latMax) / 2
+    options.proj = "+proj=utm +zone=%s %s+ellps=WGS84 +datum=WGS84 +units=m +no_defs" % (
+        int((lon + 180) / 6) + 1, "+south " if lat < 0 else "")
+    proj = pyproj.Proj(options.proj)
+    corners = [proj(x, y) for x in (lonMin, lonMax) for y in (latMin, latMax)]
+    options.boundary = [min([c[0] for c in corners]), min([c[1] for c in corners]),
+                        max([c[0] for c in corners]), max([c[1] for c in corners])]
+    options.overlap = proj(lon, lat + options.overlap)[1] - proj(lon, lat)[1]
+
+
+def tileIndex(options, x, y):
+    """ Returns the index of the tile containing the given position (clamped to the boundary) """
+    xmin, ymin, xmax, ymax = options.boundary
+    nx, ny = options.tiles
+    ix = min(max(int((x - xmin) * nx / (xmax - xmin)), 0), nx - 1)
+    iy = min(max(int((y - ymin) * ny / (ymax - ymin)), 0), ny - 1)
+    return iy * nx + ix
+
+
+def buildTiles(options, netconvert, tmpDir):
+    """ Runs netconvert for every tile and returns the network file names """
+    xmin, ymin, xmax, ymax = options.boundary
+    nx, ny = options.tiles
+    width = (xmax - xmin) / nx
+    height = (ymax - ymin) / ny
+    tiles = []
+    running = []
+    failed = False
+    for iy in range(ny):
+        for ix in range(nx):
+            netFile = os.path.join(tmpDir, "tile_%s_%s.net.xml" % (ix, iy))
+            tile = (xmin + ix * width - options.overlap, ymin + iy * height - options.overlap,
+                    xmin + (ix + 1) * width + options.overlap, ymin + (iy + 1) * height + options.overlap)
+            cmd = [netconvert, "-c", options.config, "--output-file", netFile,
+                   "--keep-edges.in-boundary", ",".join(map(str, tile)), "--offset.disable-normalization"]
+            if options.proj:
+                cmd += ["--proj", options.proj]
+            if len(running) >= options.threads:
+                failed |= running.pop(0).wait() != 0
+            running.append(subprocess.Popen(cmd + options.extra))
+            tiles.append(netFile)
+    for proc in running:
+        failed |= proc.wait() != 0
+    return None if failed else tiles
+
+
+def children(fileName):
+    """ Yields the children of the root element one by one, discarding them afterwards """
+    root = None
+    depth = 0
+    for event, elem in ET.iterparse(fileName, events=("start", "end")):
+        if event == "start":
+            if root is None:
+                root = elem
+            depth += 1
+        else:
+            depth -= 1
+            if depth == 1:
+                yield elem
+                root.remove(elem)
+
+
+def nodeOfInternal(elemID, isLane=False):
+    """ Returns the junction id of an internal edge or lane id """
+    nodeID = elemID[1:].rsplit("_", 1)[0]
+    return nodeID.rsplit("_", 1)[0] if isLane else nodeID
+
+
+class Tile:
+
+    """ The ownership of the elements of a single tile network """
+
+    def __init__(self, options, index, netFile):
+        self.owned = set()
+        self.edges = set()
+        self.tls = set()
+        self.tlsIDs = {}
+        self.location = None
+        fromNode = {}
+        toNode = {}
+        controlled = {}
+        for elem in children(netFile):
+            if elem.tag == "location":
+                self.location = dict(elem.attrib)
+            elif elem.tag == "junction" and not elem.get("id").startswith(":"):
+                if tileIndex(options, float(elem.get("x")), float(elem.get("y"))) == index:
+                    self.owned.add(elem.get("id"))
+            elif elem.tag == "edge" and elem.get("function") != "internal":
+                fromNode[elem.get("id")] = elem.get("from")
+                toNode[elem.get("id")] = elem.get("to")
+            elif elem.tag == "connection" and elem.get("tl") is not None:
+                # crossings are controlled by the traffic light of their junction as well
+                fromID = elem.get("from")
+                node = nodeOfInternal(fromID) if fromID.startswith(":") else toNode[fromID]
+                controlled.setdefault(elem.get("tl"), set()).add(node)
+            elif elem.tag == "tlLogic":
+                controlled.setdefault(elem.get("id"), set())
+        self.edges = set([e for e, n in fromNode.items() if n in self.owned])
+        for tlsID, nodes in controlled.items():
+            first = min(nodes) if nodes else tlsID
+            if first in self.owned:
+                self.tls.add(tlsID)
+            joined = JOINED_TLS.match(tlsID)
+            if joined:
+                self.tlsIDs[tlsID] = "%s_%s" % (joined.group(1), first)
+
+    def keep(self, elem):
+        elemID = elem.get("id")
+        if elem.tag == "edge":
+            if elemID.startswith(":"):
+                return nodeOfInternal(elemID) in self.owned
+            return elemID in self.edges
+        if elem.tag == "junction":
+            if elemID.startswith(":"):
+                return nodeOfInternal(elemID, True) in self.owned
+            return elemID in self.owned
+        if elem.tag == "connection":
+            fromID = elem.get("from")
+            if fromID.startswith(":"):
+                return nodeOfInternal(fromID) in self.owned
+            return fromID in self.edges
+        if elem.tag == "tlLogic":
+            return elemID in self.tls
+        if elem.tag == "roundabout":
+            return min(elem.get("nodes").split()) in self.owned
+        return None
+
+    def rename(self, elem):
+        if elem.tag == "tlLogic" and elem.get("id") in self.tlsIDs:
+            elem.set("id", self.tlsIDs[elem.get("id")])
+        elif elem.tag == "connection" and elem.get("tl") in self.tlsIDs:
+            elem.set("tl", self.tlsIDs[elem.get("tl")])
+
+
+def mergeBoundary(location, other, attr):
+    b1 = [float(v) for v in location[attr].split(",")]
+    b2 = [float(v) for v in other[attr].split(",")]
+    location[attr] = "%.2f,%.2f,%.2f,%.2f" % (min(b1[0], b2[0]), min(b1[1], b2[1]),
+                                              max(b1[2], b2[2]), max(b1[3], b2[3]))
+
+
+def stitch(options, tiles, tmpDir):
+    """ Writes the stitched network from the tile networks """
+    location = None
+    groupFiles = [os.path.join(tmpDir, "stitched_%s.xml" % group) for group in GROUPS + ("other",)]
+    outputs = [open(f, "wb") for f in groupFiles]
+    seen = set()
+    for index, netFile in enumerate(tiles):
+        tile = Tile(options, index, netFile)
+        if location is None:
+            location = tile.location
+        elif tile.location is not None:
+            mergeBoundary(location, tile.location, "convBoundary")
+            mergeBoundary(location, tile.location, "origBoundary")
+        for elem in children(netFile):
+            if elem.tag == "location":
+                continue
+            keep = tile.keep(elem)
+            if keep is None:
+                # types, prohibitions etc. are written only once
+                key = ET.tostring(elem).strip()
+                keep = key not in seen
+                seen.add(key)
+            if keep:
+                tile.rename(elem)
+                elem.tail = None
+                group = GROUPS.index(elem.tag) if elem.tag in GROUPS else len(GROUPS)
+                outputs[group].write(b"    " + ET.tostring(elem) + b"\n")
+    for out in outputs:
+        out.close()
+    root = next(ET.iterparse(tiles[0], events=("start",)))[1]
+    with open(options.output_file, "wb") as out:
+        out.write(b'<?xml version="1.0" encoding="UTF-8"?>\n\n')
+        out.write(("<net%s>\n\n" % "".join([" %s=%s" % (k, quoteattr(v))
+                                             for k, v in root.attrib.items()])).encode("utf-8"))
+        if location is not None:
+            out.write(("    <location%s/>\n\n" % "".join([" %s=%s" % (k, quoteattr(location[k]))
+                                                          for k in ("netOffset", "convBoundary", "origBoundary",
+                                                                    "projParameter") if k in location])).encode("utf-8"))
+        for fileName in groupFiles:
+            with open(fileName, "rb") as f:
+                shutil.copyfileobj(f, out)
+            if os.path.getsize(fileName) > 0:
+                out.write(b"\n")
+        out.write(b"</net>\n")
+
+
+def main():
+    options = parseArgs()
+    netconvert = sumolib.checkBinary("netconvert")
+    tmpDir = options.tmp_dir if options.tmp_dir else tempfile.mkdtemp()
+    if not os.path.isdir(tmpDir):
+        os.makedirs(tmpDir)
+    tiles = buildTiles(options, netconvert, tmpDir)
+    if tiles is None:
+        sys.exit("Building the tiles failed, check '%s'!" % tmpDir)
+    stitch(options, tiles, tmpDir)
+    if not options.tmp_dir:
+        shutil.rmtree(tmpDir)
+
+
+if __name__ == "__main__":
+    main()
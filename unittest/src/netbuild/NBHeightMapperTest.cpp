@@ -45,8 +45,35 @@ protected :
 
     virtual void TearDown(){
         NBHeightMapper &hm = NBHeightMapper::Singleton;
+        // the raster data is owned by the test
+        hm.myRasters.clear();
         hm.clearData();
     }
+
+    /// @brief adds a raster of 2x2 pixels of size 1 with the given top left corner
+    void addRaster(const Position& topLeft, int16_t* data) {
+        NBHeightMapper::Raster raster;
+        raster.data = data;
+        raster.sizeOfPixel.set(1, -1);
+        raster.xSize = 2;
+        raster.ySize = 2;
+        raster.boundary.add(topLeft);
+        raster.boundary.add(topLeft.x() + 2, topLeft.y() - 2);
+        NBHeightMapper::Singleton.myRasters.push_back(raster);
+    }
+
+    /// @brief adds two neighboring rasters meeting at x=12
+    void addTiles() {
+        addRaster(Position(10, 2), myTile0);
+        addRaster(Position(12, 2), myTile1);
+    }
+
+    double getRasterZ(const Position& geo, int& rasterHint) {
+        return NBHeightMapper::Singleton.getRasterZ(geo, rasterHint);
+    }
+
+    int16_t myTile0[4] = {1, 2, 3, 4};
+    int16_t myTile1[4] = {2, 5, 4, 7};
 };
 
 /* Test the method 'getZ'*/
@@ -60,3 +87,74 @@ TEST_F(NBHeightMapperTest, test_method_getZ) {
 }
 
 
+/* Test the method 'getZ' for a whole geometry*/
+TEST_F(NBHeightMapperTest, test_method_getZ_geometry) {
+    const NBHeightMapper &hm = NBHeightMapper::get();
+    PositionVector geo;
+    geo.push_back(Position(0.25, 0.25));
+    geo.push_back(Position(0.75, 0.75));
+    geo.push_back(Position(1.5, 0.5));
+    const std::vector<double> z = hm.getZ(geo);
+    EXPECT_EQ(3, (int)z.size());
+    EXPECT_DOUBLE_EQ(0., z[0]);
+    EXPECT_DOUBLE_EQ(1., z[1]);
+    EXPECT_DOUBLE_EQ(2., z[2]);
+}
+
+
+/* Test the method 'getRasterZ' within a single tile*/
+TEST_F(NBHeightMapperTest, test_method_getRasterZ) {
+    addTiles();
+    int hint = 0;
+    EXPECT_DOUBLE_EQ(1., getRasterZ(Position(10.5, 1.5), hint));
+    EXPECT_EQ(0, hint);
+    // halfway between the centers of the first two pixels
+    EXPECT_DOUBLE_EQ(1.5, getRasterZ(Position(11., 1.5), hint));
+    // the outer corners use the values of the corner pixels
+    EXPECT_DOUBLE_EQ(1., getRasterZ(Position(10., 2.), hint));
+    EXPECT_DOUBLE_EQ(7., getRasterZ(Position(14., 0.), hint));
+    EXPECT_EQ(1, hint);
+}
+
+
+/* Test the method 'getRasterZ' when switching tiles and on the tile border*/
+TEST_F(NBHeightMapperTest, test_method_getRasterZ_tiles) {
+    addTiles();
+    int hint = 0;
+    EXPECT_DOUBLE_EQ(7., getRasterZ(Position(13.5, 0.5), hint));
+    EXPECT_EQ(1, hint);
+    // the border belongs to both tiles and the result must not depend on the hint
+    EXPECT_DOUBLE_EQ(2., getRasterZ(Position(12., 1.5), hint));
+    EXPECT_EQ(1, hint);
+    hint = 0;
+    EXPECT_DOUBLE_EQ(2., getRasterZ(Position(12., 1.5), hint));
+    EXPECT_EQ(0, hint);
+    EXPECT_DOUBLE_EQ(4., getRasterZ(Position(12., 0.5), hint));
+    hint = 1;
+    EXPECT_DOUBLE_EQ(4., getRasterZ(Position(12., 0.5), hint));
+    // an invalid hint is ignored
+    hint = 5;
+    EXPECT_DOUBLE_EQ(7., getRasterZ(Position(13.5, 0.5), hint));
+    EXPECT_EQ(1, hint);
+}
+
+
+/* Test the method 'getRasterZ' outside of all tiles*/
+TEST_F(NBHeightMapperTest, test_method_getRasterZ_outside) {
+    addTiles();
+    int hint = 1;
+    EXPECT_DOUBLE_EQ(-1e6, getRasterZ(Position(20., 1.), hint));
+    EXPECT_EQ(0, hint);
+    EXPECT_DOUBLE_EQ(-1e6, getRasterZ(Position(11., 2.5), hint));
+    // the triangles are used where no raster is available
+    const NBHeightMapper &hm = NBHeightMapper::get();
+    PositionVector geo;
+    geo.push_back(Position(10.5, 1.5));
+    geo.push_back(Position(13.5, 0.5));
+    geo.push_back(Position(0.25, 0.25));
+    const std::vector<double> z = hm.getZ(geo);
+    EXPECT_EQ(3, (int)z.size());
+    EXPECT_DOUBLE_EQ(1., z[0]);
+    EXPECT_DOUBLE_EQ(7., z[1]);
+    EXPECT_DOUBLE_EQ(0., z[2]);
+}
@@ -36,3 +36,83 @@ TEST(GeoConvHelper, test_method_x2cartesian) {
 	EXPECT_DOUBLE_EQ(400235.50494557252, pos.x());
 	EXPECT_DOUBLE_EQ(5809666.826070101, pos.y());
 }
+
+
+/* Test the method 'x2cartesian' for a whole geometry */
+TEST(GeoConvHelper, test_method_x2cartesian_geometry) {
+    GeoConvHelper gch(
+            "+proj=utm +zone=33 +ellps=WGS84 +datum=WGS84 +units=m +no_defs",
+            Position(), Boundary(), Boundary(), 1, false);
+    GeoConvHelper gch2(
+            "+proj=utm +zone=33 +ellps=WGS84 +datum=WGS84 +units=m +no_defs",
+            Position(), Boundary(), Boundary(), 1, false);
+
+    PositionVector geom;
+    geom.push_back(Position(13.5326994, 52.428098100000007));
+    geom.push_back(Position(13.5336994, 52.429098100000007, 5));
+    geom.push_back(Position(13.5346994, 52.427098100000007));
+    PositionVector single = geom;
+    EXPECT_TRUE(gch.x2cartesian(geom));
+    for (int i = 0; i < (int)single.size(); i++) {
+        gch2.x2cartesian(single[i]);
+    }
+
+	EXPECT_DOUBLE_EQ(400235.50494557252, geom[0].x());
+	EXPECT_DOUBLE_EQ(5809666.826070101, geom[0].y());
+    for (int i = 0; i < (int)single.size(); i++) {
+        EXPECT_DOUBLE_EQ(single[i].x(), geom[i].x());
+        EXPECT_DOUBLE_EQ(single[i].y(), geom[i].y());
+        EXPECT_DOUBLE_EQ(single[i].z(), geom[i].z());
+    }
+    EXPECT_EQ(gch2.getConvBoundary(), gch.getConvBoundary());
+
+    gch.cartesian2geo(geom);
+	EXPECT_NEAR(13.5326994, geom[0].x(), 1e-7);
+	EXPECT_NEAR(52.428098100000007, geom[0].y(), 1e-7);
+}
+
+
+/* Test the method 'x2cartesian' for a whole geometry with the simple projection */
+TEST(GeoConvHelper, test_method_x2cartesian_geometry_simple) {
+    GeoConvHelper gch("-", Position(10, 20), Boundary(), Boundary(), 1, 30);
+    GeoConvHelper gch2("-", Position(10, 20), Boundary(), Boundary(), 1, 30);
+
+    PositionVector geom;
+    geom.push_back(Position(13.5326994, 52.428098100000007));
+    geom.push_back(Position(200, 52.4));
+    geom.push_back(Position(13.5346994, 52.427098100000007, 5));
+    PositionVector single = geom;
+    EXPECT_FALSE(gch.x2cartesian(geom));
+    for (int i = 0; i < (int)single.size(); i++) {
+        gch2.x2cartesian(single[i]);
+    }
+    for (int i = 0; i < (int)single.size(); i++) {
+        EXPECT_DOUBLE_EQ(single[i].x(), geom[i].x());
+        EXPECT_DOUBLE_EQ(single[i].y(), geom[i].y());
+        EXPECT_DOUBLE_EQ(single[i].z(), geom[i].z());
+    }
+    EXPECT_EQ(gch2.getConvBoundary(), gch.getConvBoundary());
+}
+
+
+/* Test that 'x2cartesian' for a whole geometry retries the initialisation of the projection */
+TEST(GeoConvHelper, test_method_x2cartesian_geometry_init) {
+    GeoConvHelper gch("DHDN", Position(), Boundary(), Boundary());
+    GeoConvHelper gch2("DHDN", Position(), Boundary(), Boundary());
+
+    PositionVector geom;
+    geom.push_back(Position(-50., 52.4));
+    geom.push_back(Position(13.5326994, 52.428098100000007));
+    geom.push_back(Position(13.5346994, 52.427098100000007));
+    PositionVector single = geom;
+    EXPECT_FALSE(gch.x2cartesian(geom));
+    for (int i = 0; i < (int)single.size(); i++) {
+        gch2.x2cartesian(single[i]);
+    }
+    for (int i = 0; i < (int)single.size(); i++) {
+        EXPECT_DOUBLE_EQ(single[i].x(), geom[i].x());
+        EXPECT_DOUBLE_EQ(single[i].y(), geom[i].y());
+    }
+    // the positions after the failed initialisation are projected
+    EXPECT_TRUE(geom[1].x() > 1000000.);
+}
@@ -0,0 +1,127 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2018-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    PositionVectorBenchmark.cpp
+/// @author  agent
+/// @date    2026-10-18
+/// @version $Id$
+///
+// Micro benchmarks for the geometry functions of PositionVector
+/****************************************************************************/
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include <utils/geom/PositionVector.h>
+#include <utils/geom/GeomHelper.h>
+#include <utils/common/SysUtils.h>
+
+/* The number of repetitions of every benchmark. The benchmarks are disabled by
+   default, run them with --gtest_also_run_disabled_tests. */
+#define NUM_QUERIES 20000
+#define NUM_SHAPES 50
+
+
+class PositionVectorBenchmark : public testing::Test {
+	protected :
+		std::vector<PositionVector> shapes;
+		std::vector<Position> queries;
+
+		virtual void SetUp(){
+			// deterministic zigzag shapes and query points, no random numbers needed
+			for (int i = 0; i < NUM_SHAPES; i++) {
+				PositionVector shape;
+				for (int j = 0; j < 10 + i; j++) {
+					shape.push_back(Position(j * 10. + i, (j % 2) * (i + 1.) + i * 3., j * 0.1));
+				}
+				shapes.push_back(shape);
+			}
+			for (int i = 0; i < NUM_QUERIES; i++) {
+				queries.push_back(Position((i * 7919) % 600 - 50., (i * 104729) % 300 - 50.));
+			}
+		}
+
+		void report(const std::string& name, const long long int start) {
+			std::cout << name << ": " << SysUtils::getCurrentMillis() - start << "ms" << std::endl;
+		}
+};
+
+
+/* Benchmark nearest_offset_to_point2D. */
+TEST_F(PositionVectorBenchmark, DISABLED_bench_nearest_offset_to_point2D) {
+	double sum = 0;
+	const long long int start = SysUtils::getCurrentMillis();
+	for (int i = 0; i < NUM_QUERIES; i++) {
+		const PositionVector& shape = shapes[i % NUM_SHAPES];
+		const double offset = shape.nearest_offset_to_point2D(queries[i], false);
+		EXPECT_TRUE(offset >= 0 && offset <= shape.length2D() + POSITION_EPS);
+		sum += offset + shape.nearest_offset_to_point2D(queries[i]);
+	}
+	report("nearest_offset_to_point2D", start);
+	EXPECT_TRUE(sum > 0);
+}
+
+/* Benchmark distance2D. */
+TEST_F(PositionVectorBenchmark, DISABLED_bench_distance2D) {
+	const long long int start = SysUtils::getCurrentMillis();
+	for (int i = 0; i < NUM_QUERIES; i++) {
+		const PositionVector& shape = shapes[i % NUM_SHAPES];
+		// the distance to the shape is never larger than the distance to its end points
+		const double dist = shape.distance2D(queries[i]);
+		EXPECT_TRUE(dist <= queries[i].distanceTo2D(shape.front()) + POSITION_EPS);
+		EXPECT_TRUE(dist <= queries[i].distanceTo2D(shape.back()) + POSITION_EPS);
+	}
+	report("distance2D", start);
+}
+
+/* Benchmark positionAtOffset. */
+TEST_F(PositionVectorBenchmark, DISABLED_bench_positionAtOffset) {
+	const long long int start = SysUtils::getCurrentMillis();
+	for (int i = 0; i < NUM_QUERIES; i++) {
+		const PositionVector& shape = shapes[i % NUM_SHAPES];
+		const double offset = (i % 100) / 100. * shape.length();
+		EXPECT_NE(Position::INVALID, shape.positionAtOffset(offset));
+		EXPECT_NE(Position::INVALID, shape.positionAtOffset2D(offset, 1.));
+	}
+	report("positionAtOffset", start);
+}
+
+/* Benchmark intersects. */
+TEST_F(PositionVectorBenchmark, DISABLED_bench_intersects) {
+	int count = 0;
+	const long long int start = SysUtils::getCurrentMillis();
+	for (int i = 0; i < NUM_SHAPES; i++) {
+		for (int j = 0; j < NUM_SHAPES; j++) {
+			if (shapes[i].intersects(shapes[j])) {
+				count++;
+			}
+		}
+	}
+	report("intersects", start);
+	// every shape intersects at least itself
+	EXPECT_TRUE(count >= NUM_SHAPES);
+}
+
+/* Benchmark getOverlapWith. */
+TEST_F(PositionVectorBenchmark, DISABLED_bench_getOverlapWith) {
+	PositionVector square;
+	square.push_back(Position(0, 0));
+	square.push_back(Position(0, 10));
+	square.push_back(Position(10, 10));
+	square.push_back(Position(10, 0));
+	square.push_back(Position(0, 0));
+	double sum = 0;
+	const long long int start = SysUtils::getCurrentMillis();
+	for (int i = 0; i < NUM_QUERIES / 10; i++) {
+		PositionVector other = square;
+		other.add(queries[i] * 0.1);
+		sum += square.getOverlapWith(other, 1.);
+	}
+	report("getOverlapWith", start);
+	EXPECT_TRUE(sum > 0);
+}
@@ -572,3 +572,19 @@ TEST_F(PositionVectorTest, test_method_overlapsWith) {
     EXPECT_FALSE(vec1.overlapsWith(empty));
 }
 
+/* Test the method 'getOverlapWith'*/
+TEST_F(PositionVectorTest, test_method_getOverlapWith) {
+    PositionVector square;
+    square.push_back(Position(0, 0));
+    square.push_back(Position(0, 10));
+    square.push_back(Position(10, 10));
+    square.push_back(Position(10, 0));
+    square.push_back(Position(0, 0));
+    // a shifted square overlaps by the length of the inner corner's distance to the border
+    PositionVector shifted = square;
+    shifted.add(Position(5, 5));
+    EXPECT_DOUBLE_EQ(5., square.getOverlapWith(shifted, 1.));
+    PositionVector far = square;
+    far.add(Position(100, 100));
+    EXPECT_DOUBLE_EQ(0., square.getOverlapWith(far, 1.));
+}
@@ -0,0 +1,107 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2001-2018 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    FrontierHeapTest.cpp
+/// @author  agent
+/// @date    2026-10-18
+/// @version $Id$
+///
+// Tests FrontierHeap class from <SUMO>/src/utils/vehicle
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <config.h>
+
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+#include <utils/vehicle/FrontierHeap.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests the order of popped elements including ties. */
+TEST(FrontierHeap, test_pop_order) {
+    FrontierHeap heap(10);
+    heap.update(3, 2.);
+    heap.update(7, 1.);
+    heap.update(5, 2.);
+    heap.update(1, 3.);
+    heap.update(0, 2.);
+    EXPECT_EQ(5, heap.size());
+    EXPECT_EQ(7, heap.top());
+    EXPECT_DOUBLE_EQ(1., heap.topKey());
+    heap.pop();
+    EXPECT_EQ(0, heap.top());
+    heap.pop();
+    EXPECT_EQ(3, heap.top());
+    heap.pop();
+    EXPECT_EQ(5, heap.top());
+    heap.pop();
+    EXPECT_EQ(1, heap.top());
+    heap.pop();
+    EXPECT_TRUE(heap.empty());
+}
+
+/* Tests decreasing and increasing keys of contained elements. */
+TEST(FrontierHeap, test_update) {
+    FrontierHeap heap(10);
+    for (int i = 0; i < 10; i++) {
+        heap.update(i, 10. + i);
+    }
+    EXPECT_TRUE(heap.contains(9));
+    heap.update(9, 1.);
+    EXPECT_EQ(9, heap.top());
+    heap.update(9, 15.5);
+    EXPECT_EQ(0, heap.top());
+    EXPECT_EQ(10, heap.size());
+    std::vector<int> order;
+    while (!heap.empty()) {
+        order.push_back(heap.top());
+        heap.pop();
+    }
+    const int expected[] = {0, 1, 2, 3, 4, 5, 9, 6, 7, 8};
+    EXPECT_TRUE(std::equal(order.begin(), order.end(), expected));
+    EXPECT_FALSE(heap.contains(9));
+}
+
+/* Tests the heap against sorting for many elements. */
+TEST(FrontierHeap, test_against_sort) {
+    const int n = 1000;
+    FrontierHeap heap(n);
+    std::vector<std::pair<double, int> > ref;
+    for (int i = 0; i < n; i++) {
+        const double key = (double)((i * 7919) % 113);
+        heap.update(i, key);
+        ref.push_back(std::make_pair(key, i));
+    }
+    std::sort(ref.begin(), ref.end());
+    for (const std::pair<double, int>& r : ref) {
+        ASSERT_EQ(r.second, heap.top());
+        heap.pop();
+    }
+    EXPECT_TRUE(heap.empty());
+}
+
+/* Tests that clear allows reusing the heap. */
+TEST(FrontierHeap, test_clear) {
+    FrontierHeap heap(5);
+    heap.update(2, 1.);
+    heap.update(4, 0.);
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_FALSE(heap.contains(2));
+    heap.update(2, 3.);
+    EXPECT_EQ(2, heap.top());
+    EXPECT_EQ(1, heap.size());
+}